@@ -0,0 +1,64 @@
+#include "AirBudget.h"
+#include "BasicDefines.h"
+
+AirBudget::AirBudget():
+	m_fillRate(AIR_FILL_RATE),
+	m_pressure(AIR_MIN_PRESSURE),
+	m_full(false),
+	m_lastUpdate(0)
+{
+}
+
+AirBudget::~AirBudget()
+{
+}
+
+void AirBudget::Start(UINT32 now, bool full)
+{
+	m_lastUpdate = now;
+	m_full = full;
+	m_pressure = full ? AIR_SWITCH_OFF_PRESSURE : AIR_MIN_PRESSURE;
+}
+
+void AirBudget::Update(UINT32 now, bool full, bool compressorEnabled)
+{
+	double dt = (INT32)(now - m_lastUpdate) / 1e6;
+	m_lastUpdate = now;
+
+	if (full != m_full)
+	{
+		m_full = full;
+		m_pressure = full ? AIR_SWITCH_ON_PRESSURE : AIR_SWITCH_OFF_PRESSURE;
+		return;
+	}
+
+	// The compressor task runs the pump whenever the switch is open
+	if (compressorEnabled && !full && dt > 0.0)
+	{
+		m_pressure += m_fillRate * dt;
+		// Still short of the switch, or it would have closed
+		if (m_pressure > AIR_SWITCH_ON_PRESSURE)
+		{
+			m_pressure = AIR_SWITCH_ON_PRESSURE;
+		}
+	}
+}
+
+void AirBudget::Use(double cost)
+{
+	m_pressure -= cost;
+	if (m_pressure < 0.0)
+	{
+		m_pressure = 0.0;
+	}
+}
+
+bool AirBudget::CanAfford(double cost, double keep)
+{
+	return GetReserve() - cost >= keep;
+}
+
+double AirBudget::GetReserve()
+{
+	return m_pressure - AIR_MIN_PRESSURE;
+}
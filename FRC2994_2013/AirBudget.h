@@ -0,0 +1,51 @@
+#ifndef AIRBUDGET_H_
+#define AIRBUDGET_H_
+
+#include "WPILib.h"
+
+// Estimate of the air left in the storage tanks, so the shifter can be
+// refused before it uses air the claw locks need for the climb. Air is
+// counted as the tank pressure it is worth (psi): each actuation of a
+// cylinder costs its volume at working pressure, and the compressor adds
+// AIR_FILL_RATE psi a second while it runs.
+
+// The estimate is put right whenever the pressure switch changes: it
+// closes (reads full) at AIR_SWITCH_ON_PRESSURE and opens again at
+// AIR_SWITCH_OFF_PRESSURE. Until the switch has been seen to change the
+// pressure is taken as AIR_SWITCH_OFF_PRESSURE if it reads full and as
+// AIR_MIN_PRESSURE (nothing to spare) if it does not. The reserve is the
+// pressure above AIR_MIN_PRESSURE, below which the cylinders do not move
+// reliably.
+
+// To use, call Start with the first pressure switch reading of a mode,
+// then Update every pass of the loop with the loop's FPGA time, the switch
+// reading and whether the compressor is enabled, and Use for every
+// actuation. CanAfford says whether an actuation would leave a given
+// reserve untouched.
+
+class AirBudget
+{
+public:
+	AirBudget();
+	~AirBudget();
+
+	// psi of tank pressure a second
+	void SetFillRate(double fillRate) { m_fillRate = fillRate; }
+
+	void Start(UINT32 now, bool full);
+	void Update(UINT32 now, bool full, bool compressorEnabled);
+
+	void Use(double cost);
+	bool CanAfford(double cost, double keep);
+
+	// psi
+	double GetPressure() { return m_pressure; }
+	double GetReserve();
+
+private:
+	double m_fillRate;
+	double m_pressure;
+	bool m_full;
+	UINT32 m_lastUpdate;
+};
+#endif
@@ -0,0 +1,146 @@
+#include "AnalogFilter.h"
+
+AnalogFilter::AnalogFilter():
+	m_started(false),
+	m_lastUpdate(0),
+	m_output(0.0f),
+	m_medianTaps(1),
+	m_medianNext(0),
+	m_smoothing(kSmoothNone),
+	m_averageTaps(1),
+	m_averageNext(0),
+	m_averageSum(0.0),
+	m_timeConstant(0.0)
+{
+	for (UINT32 i = 0; i < ANALOG_FILTER_MAX_TAPS; i++)
+	{
+		m_medianHistory[i] = 0.0f;
+		m_averageHistory[i] = 0.0f;
+	}
+}
+
+AnalogFilter::~AnalogFilter()
+{
+}
+
+void AnalogFilter::SetMedian(UINT32 taps)
+{
+	m_medianTaps = Taps(taps);
+	m_medianNext %= m_medianTaps;
+}
+
+void AnalogFilter::SetMovingAverage(UINT32 taps)
+{
+	m_smoothing = kSmoothAverage;
+	m_averageTaps = Taps(taps);
+	m_averageNext %= m_averageTaps;
+
+	// The running sum has to cover exactly the taps now in use
+	m_averageSum = 0.0;
+	for (UINT32 i = 0; i < m_averageTaps; i++)
+	{
+		m_averageSum += m_averageHistory[i];
+	}
+}
+
+void AnalogFilter::SetExponential(double timeConstant)
+{
+	m_smoothing = kSmoothExponential;
+	m_timeConstant = timeConstant;
+}
+
+void AnalogFilter::SetUnsmoothed()
+{
+	m_smoothing = kSmoothNone;
+}
+
+void AnalogFilter::Reset()
+{
+	m_started = false;
+}
+
+float AnalogFilter::Update(UINT32 now, float sample)
+{
+	if (!m_started)
+	{
+		m_started = true;
+		for (UINT32 i = 0; i < ANALOG_FILTER_MAX_TAPS; i++)
+		{
+			m_medianHistory[i] = sample;
+			m_averageHistory[i] = sample;
+		}
+		m_averageSum = (double)sample * m_averageTaps;
+		m_lastUpdate = now;
+		m_output = sample;
+		return m_output;
+	}
+
+	float median = sample;
+	if (m_medianTaps > 1)
+	{
+		m_medianHistory[m_medianNext] = sample;
+		m_medianNext = (m_medianNext + 1) % m_medianTaps;
+		median = Median();
+	}
+
+	// Both smoothing stages keep their history up to date, so switching
+	// between them does not start from stale samples.
+	m_averageSum += median - m_averageHistory[m_averageNext];
+	m_averageHistory[m_averageNext] = median;
+	m_averageNext = (m_averageNext + 1) % m_averageTaps;
+
+	switch (m_smoothing)
+	{
+	case kSmoothNone:
+		m_output = median;
+		break;
+	case kSmoothAverage:
+		m_output = (float)(m_averageSum / m_averageTaps);
+		break;
+	case kSmoothExponential:
+		{
+			// The weight follows the actual time since the last update, as
+			// in ShooterSpeed, so a late pass does not change the filter.
+			double dt = (INT32)(now - m_lastUpdate) / 1e6;
+			if (dt > 0.0)
+			{
+				m_output += (float)(dt / (m_timeConstant + dt) * (median - m_output));
+			}
+		}
+		break;
+	}
+	m_lastUpdate = now;
+	return m_output;
+}
+
+UINT32 AnalogFilter::Taps(UINT32 taps)
+{
+	if (taps < 1)
+	{
+		return 1;
+	}
+	if (taps > ANALOG_FILTER_MAX_TAPS)
+	{
+		return ANALOG_FILTER_MAX_TAPS;
+	}
+	return taps;
+}
+
+// Insertion sort of a copy; at most ANALOG_FILTER_MAX_TAPS samples, so this
+// is cheaper than anything cleverer.
+float AnalogFilter::Median()
+{
+	float sorted[ANALOG_FILTER_MAX_TAPS];
+	for (UINT32 i = 0; i < m_medianTaps; i++)
+	{
+		float value = m_medianHistory[i];
+		UINT32 j = i;
+		while (j > 0 && sorted[j - 1] > value)
+		{
+			sorted[j] = sorted[j - 1];
+			j--;
+		}
+		sorted[j] = value;
+	}
+	return sorted[m_medianTaps / 2];
+}
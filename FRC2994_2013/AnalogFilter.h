@@ -0,0 +1,66 @@
+#ifndef ANALOGFILTER_H_
+#define ANALOGFILTER_H_
+
+#include "WPILib.h"
+
+// Software filter for one analog input, run once per tick on the value in
+// the input snapshot. Two stages, either of which can be left out:
+//   a median of the last N samples, which throws away single-sample spikes
+//     without smearing real steps, then
+//   a smoothing stage: either a moving average of the last N medians or a
+//     first order low pass with a time constant in seconds.
+// The sample history lives in fixed ring buffers of ANALOG_FILTER_MAX_TAPS,
+// so nothing is allocated and the work per tick is bounded.
+
+// To use, configure the stages, then call Update once per pass of the loop
+// with the loop's FPGA time and the raw sample. The first Update (and the
+// first after Reset) fills the history with that sample, so the filter
+// starts at the input instead of climbing up to it from zero. Changing a
+// stage keeps its history.
+
+#define ANALOG_FILTER_MAX_TAPS 9
+
+class AnalogFilter
+{
+public:
+	AnalogFilter();
+	~AnalogFilter();
+
+	// Taps of 1 or less leave the median stage out.
+	void SetMedian(UINT32 taps);
+	// Moving average over the last taps samples.
+	void SetMovingAverage(UINT32 taps);
+	// First order low pass, time constant in seconds.
+	void SetExponential(double timeConstant);
+	// No smoothing stage.
+	void SetUnsmoothed();
+
+	void Reset();
+	float Update(UINT32 now, float sample);
+	float Get() { return m_output; }
+
+private:
+	typedef enum
+	{
+		kSmoothNone, kSmoothAverage, kSmoothExponential
+	} Smoothing;
+
+	static UINT32 Taps(UINT32 taps);
+	float Median();
+
+	bool m_started;
+	UINT32 m_lastUpdate;
+	float m_output;
+
+	UINT32 m_medianTaps;
+	UINT32 m_medianNext;
+	float m_medianHistory[ANALOG_FILTER_MAX_TAPS];
+
+	Smoothing m_smoothing;
+	UINT32 m_averageTaps;
+	UINT32 m_averageNext;
+	double m_averageSum;
+	float m_averageHistory[ANALOG_FILTER_MAX_TAPS];
+	double m_timeConstant;
+};
+#endif
@@ -0,0 +1,176 @@
+#include "ArmController.h"
+#include "BasicDefines.h"
+#include <math.h>
+
+ArmController::ArmController(SpeedController &motor):
+	m_motor(motor),
+	m_loop(ARM_KP, ARM_KI, ARM_KD, ARM_INTEGRAL_LIMIT),
+	m_mode(kArmOff),
+	m_manualOutput(0.0),
+	m_setpoint(0.0),
+	m_climbLimit(0.0),
+	m_descendLimit(5.0),
+	m_lastUpdate(0),
+	m_position(0.0),
+	m_velocity(0.0)
+{
+}
+
+ArmController::~ArmController()
+{
+}
+
+void ArmController::SetLimits(double climbLimit, double descendLimit)
+{
+	m_climbLimit = climbLimit;
+	m_descendLimit = descendLimit;
+	m_setpoint = Clamp(m_setpoint);
+}
+
+void ArmController::Reset(UINT32 now, float position)
+{
+	m_lastUpdate = now;
+	m_position = position;
+	m_velocity = 0.0;
+	m_setpoint = Clamp(m_position);
+	Stop();
+}
+
+void ArmController::Drive(double output)
+{
+	m_mode = kArmManual;
+	m_manualOutput = output;
+}
+
+void ArmController::Hold()
+{
+	SetSetpoint(m_position);
+}
+
+void ArmController::SetSetpoint(double volts)
+{
+	if (kArmPosition != m_mode)
+	{
+		m_loop.Reset();
+		m_mode = kArmPosition;
+	}
+	m_setpoint = Clamp(volts);
+}
+
+void ArmController::SetSetpoint(ArmSetpoint setpoint)
+{
+	switch (setpoint)
+	{
+	case kArmSetpointCenter:
+		SetSetpoint(ARM_SETPOINT_CENTER);
+		break;
+	case kArmSetpointReach:
+		SetSetpoint(ARM_SETPOINT_REACH);
+		break;
+	case kArmSetpointClimb:
+		SetSetpoint(ARM_SETPOINT_CLIMB);
+		break;
+	}
+}
+
+void ArmController::Jog(double volts)
+{
+	// Step from where the arm was headed, or from where it is if it was not
+	// holding a position, so repeated presses add up.
+	SetSetpoint((kArmPosition == m_mode ? m_setpoint : m_position) + volts);
+}
+
+void ArmController::Stop()
+{
+	m_mode = kArmOff;
+	m_manualOutput = 0.0;
+	m_motor.Set(0.0);
+}
+
+void ArmController::Update(UINT32 now, float position)
+{
+	double dt = (INT32)(now - m_lastUpdate) / 1e6;
+	m_lastUpdate = now;
+	if (dt > 0.0)
+	{
+		m_velocity = (position - m_position) / dt;
+	}
+	m_position = position;
+
+	double output = 0.0;
+	double feedForward = 0.0;
+	switch (m_mode)
+	{
+	case kArmOff:
+		return;
+	case kArmManual:
+		output = m_manualOutput;
+		break;
+	case kArmPosition:
+		{
+			// Gravity pulls hardest with the arm level
+			double angle = (m_position - ARM_LEVEL_VOLTS) * ARM_RADIANS_PER_VOLT;
+			feedForward = ARM_KG * cos(angle);
+			output = m_loop.Calculate(m_setpoint - m_position, -m_velocity, dt);
+		}
+		break;
+	}
+
+	// The soft limit applies to the whole output, feed-forward included, so
+	// nothing can push the arm on into the zone before a limit.
+	m_motor.Set(Limit(SoftLimit(Limit(output + feedForward))));
+}
+
+double ArmController::Limit(double output)
+{
+	if (output > 1.0)
+	{
+		return 1.0;
+	}
+	if (output < -1.0)
+	{
+		return -1.0;
+	}
+	return output;
+}
+
+bool ArmController::AtSetpoint()
+{
+	return kArmPosition == m_mode && fabs(m_setpoint - m_position) < ARM_POSITION_TOLERANCE;
+}
+
+double ArmController::Clamp(double volts)
+{
+	if (volts < m_climbLimit)
+	{
+		return m_climbLimit;
+	}
+	if (volts > m_descendLimit)
+	{
+		return m_descendLimit;
+	}
+	return volts;
+}
+
+// Scale down output that heads toward a limit as the arm gets close to it.
+double ArmController::SoftLimit(double output)
+{
+	double room;
+	if (output < 0.0)
+	{
+		room = m_position - m_climbLimit;
+	}
+	else
+	{
+		room = m_descendLimit - m_position;
+	}
+	if (room <= 0.0)
+	{
+		return 0.0;
+	}
+	if (room < ARM_SOFT_LIMIT_ZONE)
+	{
+		return output * room / ARM_SOFT_LIMIT_ZONE;
+	}
+	return output;
+}
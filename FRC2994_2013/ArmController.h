@@ -0,0 +1,80 @@
+#ifndef ARMCONTROLLER_H_
+#define ARMCONTROLLER_H_
+
+#include "WPILib.h"
+#include "PIDLoop.h"
+
+// Arm position servo on the rotation potentiometer. In position mode a PID
+// on the filtered pot voltage, plus a gravity feed-forward that depends on
+// the arm angle (off by default, see ARM_KG), drives the arm to a setpoint and holds it there. Setpoints
+// are given in pot volts, by name or as steps from the current one, and
+// are kept inside the soft limits.
+
+// In manual mode the driver's stick goes straight to the motor. In either
+// mode the output toward a limit is scaled down over the last
+// ARM_SOFT_LIMIT_ZONE volts before it, so the arm slows to a stop at the
+// limit instead of being cut off at full speed.
+
+// Pot volts go down as the arm climbs; a positive motor output moves the
+// pot up.
+
+// To use, call Reset with the first pot reading (the arm starts off), then
+// Update every pass of the loop with the loop's FPGA time and the filtered
+// pot voltage for it, after any Drive/Hold/Set/Jog call for the pass.
+
+typedef enum
+{
+	kArmSetpointCenter, kArmSetpointReach, kArmSetpointClimb
+} ArmSetpoint;
+
+class ArmController
+{
+public:
+	explicit ArmController(SpeedController &motor);
+	~ArmController();
+
+	// Pot volts the arm may not be driven past (climbing, descending).
+	void SetLimits(double climbLimit, double descendLimit);
+	void Reset(UINT32 now, float position);
+
+	// Manual mode, output -1..1.
+	void Drive(double output);
+	// Position mode. Hold keeps the arm where it is now.
+	void Hold();
+	void SetSetpoint(double volts);
+	void SetSetpoint(ArmSetpoint setpoint);
+	void Jog(double volts);
+	// Motor off until the next Drive/Hold/Set/Jog.
+	void Stop();
+
+	void Update(UINT32 now, float position);
+
+	bool IsManual() { return kArmManual == m_mode; }
+	bool IsHolding() { return kArmPosition == m_mode; }
+	bool AtSetpoint();
+	double GetPosition() { return m_position; }
+	double GetSetpoint() { return m_setpoint; }
+
+private:
+	typedef enum
+	{
+		kArmOff, kArmManual, kArmPosition
+	} ArmMode;
+
+	double Clamp(double volts);
+	double Limit(double output);
+	double SoftLimit(double output);
+
+	SpeedController &m_motor;
+	PIDLoop m_loop;
+	ArmMode m_mode;
+	double m_manualOutput;
+	double m_setpoint;
+	double m_climbLimit;
+	double m_descendLimit;
+
+	UINT32 m_lastUpdate;
+	double m_position;
+	double m_velocity;
+};
+#endif
@@ -0,0 +1,50 @@
+#include "ArmSubsystem.h"
+#include "BasicDefines.h"
+
+ArmSubsystem::ArmSubsystem(SpeedController &motor):
+	Subsystem("Arm", ARM_UPDATE_BUDGET),
+	m_potentiometer(ARM_ROTATION_POT),
+	m_arm(motor)
+{
+}
+
+ArmSubsystem::~ArmSubsystem()
+{
+}
+
+void ArmSubsystem::ReadInputs(InputSnapshot &inputs)
+{
+	inputs.potentiometer = m_potentiometer.GetVoltage();
+}
+
+void ArmSubsystem::Start(const InputSnapshot &inputs)
+{
+	m_arm.Reset(inputs.timestamp, inputs.filteredPotentiometer);
+}
+
+// The stick is read here, after the dispatch, so it wins over a button
+// pressed while it is held.
+void ArmSubsystem::Update(const InputSnapshot &inputs)
+{
+	// Climb or descend (fast)
+	if (inputs.gamepadLeftY < -0.1 || inputs.gamepadLeftY > 0.1)
+	{
+		m_arm.Drive(inputs.gamepadLeftY);
+	}
+	// Stick let go
+	else if (m_arm.IsManual())
+	{
+		m_arm.Hold();
+	}
+	m_arm.Update(inputs.timestamp, inputs.filteredPotentiometer);
+}
+
+void ArmSubsystem::Stop()
+{
+	m_arm.Stop();
+}
+
+void ArmSubsystem::SetLimits(double climbLimit, double descendLimit)
+{
+	m_arm.SetLimits(climbLimit, descendLimit);
+}
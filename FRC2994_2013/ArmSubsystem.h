@@ -0,0 +1,34 @@
+#ifndef ARMSUBSYSTEM_H_
+#define ARMSUBSYSTEM_H_
+
+#include "WPILib.h"
+#include "Subsystem.h"
+#include "ArmController.h"
+
+// The arm: its rotation pot and the ArmController servo on it. In teleop
+// the left gamepad stick drives the arm directly and the arm holds where
+// it is left when the stick is let go; the jog, named position and stop
+// calls come from the button bindings, before Update on the same tick.
+
+class ArmSubsystem : public Subsystem
+{
+public:
+	explicit ArmSubsystem(SpeedController &motor);
+	~ArmSubsystem();
+
+	void ReadInputs(InputSnapshot &inputs);
+	// The arm stays where it is until the driver moves it
+	void Start(const InputSnapshot &inputs);
+	void Update(const InputSnapshot &inputs);
+	void Stop();
+
+	void SetLimits(double climbLimit, double descendLimit);
+	void Jog(double volts) { m_arm.Jog(volts); }
+	void SetSetpoint(ArmSetpoint setpoint) { m_arm.SetSetpoint(setpoint); }
+	bool IsHolding() { return m_arm.IsHolding(); }
+
+private:
+	AnalogChannel m_potentiometer;
+	ArmController m_arm;
+};
+#endif
@@ -0,0 +1,176 @@
+#include "AutonomousEngine.h"
+#include <math.h>
+
+AutonomousEngine::AutonomousEngine(RobotDrive &drive, SpeedController &shooter,
+		SpeedController &indexer, EDigitalInput &indexerSwitch,
+		ShooterSpeed &shooterSpeed, DriveController &driveController,
+		DriveOdometry &odometry, ParameterStore &parameters):
+	m_drive(drive),
+	m_shooter(shooter),
+	m_indexer(indexer),
+	m_indexerSwitch(indexerSwitch),
+	m_shooterSpeed(shooterSpeed),
+	m_driveController(driveController),
+	m_odometry(odometry),
+	m_parameters(parameters),
+	m_shooterState(kShooterDone),
+	m_shooterStateStart(0),
+	m_disksShot(0),
+	m_driveState(kDriveDone),
+	m_steps(NULL),
+	m_trajectory(NULL),
+	m_numSteps(0),
+	m_step(0),
+	m_stepStartDistance(0.0)
+{
+}
+
+AutonomousEngine::~AutonomousEngine()
+{
+}
+
+void AutonomousEngine::Start(const InputSnapshot &inputs, const step_speed *steps, UINT32 numSteps,
+		const TrajectoryTable *trajectory)
+{
+	// Spin the shooter up to speed before the first disk
+	m_shooter.Set(m_parameters.Get().shooterForward);
+	m_shooterState = kShooterSpinUp;
+	m_shooterStateStart = inputs.timestamp;
+	m_disksShot = 0;
+
+	m_steps = steps;
+	m_trajectory = trajectory;
+	m_numSteps = (NULL == steps) ? 0 : numSteps;
+	m_step = 0;
+	m_driveState = kDriveDone;
+	if (m_numSteps > 0)
+	{
+		StartDriveStep(inputs.timestamp);
+	}
+}
+
+bool AutonomousEngine::Tick(const InputSnapshot &inputs)
+{
+	TickShooter(inputs.timestamp);
+	TickDrive(inputs.timestamp);
+	return kShooterDone == m_shooterState && kDriveDone == m_driveState;
+}
+
+void AutonomousEngine::Stop()
+{
+	m_indexerSwitch.CancelResume();
+	m_indexer.Set(0.0);
+	m_shooter.Set(0.0);
+	m_driveController.Stop();
+	m_drive.Drive(0.0, 0.0);
+	m_shooterState = kShooterDone;
+	m_driveState = kDriveDone;
+}
+
+void AutonomousEngine::TickShooter(UINT32 now)
+{
+	INT32 elapsed = (INT32)(now - m_shooterStateStart);
+
+	switch (m_shooterState)
+	{
+	case kShooterSpinUp:
+		// The time limit is only a fallback in case the speed sensor fails
+		if (m_shooterSpeed.IsReadyToFire() || elapsed >= (INT32)(m_parameters.Get().shooterSpinupTime * 1e6))
+		{
+			m_indexer.Set(m_parameters.Get().indexerForward);
+			m_shooterState = kShooterIndexing;
+			m_shooterStateStart = now;
+		}
+		break;
+
+	case kShooterIndexing:
+		// One turn of the indexer feeds one disk; the switch opens as the
+		// cam comes back round.
+		if (kEventOpened == m_indexerSwitch.GetEvent())
+		{
+			m_indexerSwitch.CancelResume();
+			m_indexer.Set(0.0);
+			m_disksShot++;
+			if (m_disksShot >= NUM_AUTONOMOUS_DISKS)
+			{
+				// Nothing left to shoot, so there is no need to wait for
+				// the shooter to spin back up.
+				m_shooter.Set(0.0);
+				m_shooterState = kShooterDone;
+			}
+			else
+			{
+				m_shooterSpeed.RestartReady(now);
+				m_shooterState = kShooterRecovering;
+				m_shooterStateStart = now;
+			}
+		}
+		break;
+
+	case kShooterRecovering:
+		// Let the shooter motor get back up to full speed
+		if (m_shooterSpeed.IsReadyToFire() || elapsed >= (INT32)(m_parameters.Get().reSpinupTime * 1e6))
+		{
+			m_indexer.Set(m_parameters.Get().indexerForward);
+			m_shooterState = kShooterIndexing;
+			m_shooterStateStart = now;
+		}
+		break;
+
+	case kShooterDone:
+		break;
+	}
+}
+
+void AutonomousEngine::StartDriveStep(UINT32 now)
+{
+	const step_speed &step = m_steps[m_step];
+
+	// Straight steps follow their segment of the trajectory table closed
+	// loop. Curved steps (which have no segment) still drive open loop until
+	// the path distance is covered.
+	m_stepStartDistance = m_odometry.GetDistance();
+	if (NULL != m_trajectory && m_trajectory->HasSegment(m_step))
+	{
+		m_driveController.Start(now, m_odometry, *m_trajectory, m_step);
+		m_driveState = kDriveClosedLoop;
+	}
+	else
+	{
+		m_drive.Drive(step.magnitude, step.curve);
+		m_driveState = kDriveOpenLoop;
+	}
+}
+
+void AutonomousEngine::TickDrive(UINT32 now)
+{
+	bool stepDone;
+	switch (m_driveState)
+	{
+	case kDriveClosedLoop:
+		stepDone = m_driveController.Tick(now, m_odometry);
+		break;
+
+	case kDriveOpenLoop:
+		stepDone = fabs(m_odometry.GetDistance() - m_stepStartDistance) >= m_steps[m_step].distance;
+		break;
+
+	default:
+		return;
+	}
+	if (!stepDone)
+	{
+		return;
+	}
+
+	m_step++;
+	if (m_step < m_numSteps)
+	{
+		StartDriveStep(now);
+	}
+	else
+	{
+		m_drive.Drive(0.0, 0.0);
+		m_driveState = kDriveDone;
+	}
+}
@@ -0,0 +1,80 @@
+#ifndef AUTONOMOUSENGINE_H_
+#define AUTONOMOUSENGINE_H_
+
+#include "WPILib.h"
+#include "BasicDefines.h"
+#include "EDigitalInput.h"
+#include "InputSnapshot.h"
+#include "ShooterSpeed.h"
+#include "DriveController.h"
+#include "DriveOdometry.h"
+#include "TrajectoryTable.h"
+#include "ParameterStore.h"
+
+// Runs autonomous mode as two state machines that are stepped once per
+// pass of the autonomous loop instead of blocking in Wait calls: one for
+// the shooter (spin up, then index and recover once per disk) and one that
+// works through a drive step table (straight steps along a precomputed
+// TrajectoryTable with DriveController, curved ones open loop). Both advance on the same tick, so the
+// robot can drive while the shooter spins up or fires. Each disk is fired
+// as soon as ShooterSpeed reports the wheel back up to speed.
+
+// To use, call Start once when autonomous begins and then Tick on every
+// pass with that pass's inputs, after the indexer switch and the odometry
+// have been updated from them. Stop turns everything off (e.g. when autonomous ends early).
+
+class AutonomousEngine
+{
+public:
+	AutonomousEngine(RobotDrive &drive, SpeedController &shooter,
+			SpeedController &indexer, EDigitalInput &indexerSwitch,
+			ShooterSpeed &shooterSpeed, DriveController &driveController,
+			DriveOdometry &odometry, ParameterStore &parameters);
+	~AutonomousEngine();
+
+	// Passing NULL or no steps leaves the drive alone. The trajectory must
+	// have been generated from the same steps.
+	void Start(const InputSnapshot &inputs, const step_speed *steps, UINT32 numSteps,
+			const TrajectoryTable *trajectory);
+	// Returns true once both the shooter and the drive have finished.
+	bool Tick(const InputSnapshot &inputs);
+	void Stop();
+
+	UINT32 GetDisksShot() { return m_disksShot; }
+
+private:
+	typedef enum
+	{
+		kShooterSpinUp, kShooterIndexing, kShooterRecovering, kShooterDone
+	} ShooterState;
+
+	typedef enum
+	{
+		kDriveClosedLoop, kDriveOpenLoop, kDriveDone
+	} DriveState;
+
+	void TickShooter(UINT32 now);
+	void TickDrive(UINT32 now);
+	void StartDriveStep(UINT32 now);
+
+	RobotDrive &m_drive;
+	SpeedController &m_shooter;
+	SpeedController &m_indexer;
+	EDigitalInput &m_indexerSwitch;
+	ShooterSpeed &m_shooterSpeed;
+	DriveController &m_driveController;
+	DriveOdometry &m_odometry;
+	ParameterStore &m_parameters;
+
+	ShooterState m_shooterState;
+	UINT32 m_shooterStateStart;
+	UINT32 m_disksShot;
+
+	DriveState m_driveState;
+	const step_speed *m_steps;
+	const TrajectoryTable *m_trajectory;
+	UINT32 m_numSteps;
+	UINT32 m_step;
+	double m_stepStartDistance;
+};
+#endif
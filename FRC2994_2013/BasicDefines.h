@@ -13,13 +13,6 @@ typedef enum
 	kStateOpen, kStateClosed, kStateErr
 } StateType;
 
-typedef struct
-{
-	StateType state; 
-	EventType event;
-	bool enabled;
-} ButtonEntry;
-
 typedef struct
 {
 	float magnitude;
@@ -31,9 +24,34 @@ typedef struct
 // 8 inch wheel: PI*8/360 = 3.14159265*8/360 = .06981317 inches per pulse
 #define DRIVE_ENCODER_DISTANCE_PER_PULSE 	0.06981317
 
+// Distance between the left and right wheels (inches), for odometry
+#define DRIVE_TRACK_WIDTH 24.0
+
+// Closed loop drive moves (see DriveController). Velocities in inches per
+// second, accelerations in inches per second squared, outputs are motor
+// settings (-1..1). KV is the output needed per inch per second of speed
+// and KA the extra needed per inch per second squared of acceleration.
+#define DRIVE_MAX_VELOCITY 100.0
+#define DRIVE_MAX_ACCELERATION 150.0
+#define DRIVE_KV (1.0 / 120.0)
+#define DRIVE_KA (0.15 / 120.0)
+#define DRIVE_KP 0.05
+#define DRIVE_KI 0.01
+#define DRIVE_KD 0.002
+#define DRIVE_INTEGRAL_LIMIT 10.0
+#define HEADING_KP 1.5
+#define HEADING_KD 0.05
+#define DRIVE_POSITION_TOLERANCE 1.0
+#define DRIVE_VELOCITY_TOLERANCE 2.0
+#define DRIVE_SETTLE_TIMEOUT 1.0
+
 // Table over motor speeds and travel distances for autonomous mode
 #define NUM_AUTONOMOUS_STEPS 2
 
+// Define to drive the m_autoForward steps in autonomous (at the same time as
+// shooting). Not yet tried on the field.
+//#define AUTONOMOUS_DRIVE
+
 // The robot only carries three disks, but sometimes the third one gets stuck.
 // We shoot a fourth time to make sure we've gotten rid of the pesky third one...
 #define NUM_AUTONOMOUS_DISKS 4
@@ -48,62 +66,68 @@ const step_speed m_autoForward[NUM_AUTONOMOUS_STEPS] =
 		{-0.4, 0.0,50}
 };
 
-// Maximum Shifts Allowed (to make sure there is enough air for claw locks when 
-// climbing
-#define MAX_SHIFTS 50
+// The arm jog step, shooter and indexer settings, the spin-up times,
+// AIR_FILL_RATE, AIR_CLAW_RESERVE, the pot filter and POT_EPSILON below are only
+// defaults: TUNING_FILE can override them on the robot.
+
+// Air budget (see AirBudget), in psi of tank pressure. The pressure switch
+// closes at the ON pressure and opens again at the OFF pressure; the
+// cylinders need the MIN pressure to move reliably. The fill rate is a
+// cautious figure for our compressor on our tanks, and the costs are one
+// cylinder volume at working pressure.
+#define AIR_SWITCH_ON_PRESSURE 120.0
+#define AIR_SWITCH_OFF_PRESSURE 95.0
+#define AIR_MIN_PRESSURE 60.0
+#define AIR_FILL_RATE 3.0
+#define AIR_PER_SHIFT 1.5
+#define AIR_PER_CLAW 1.0
+// Claw actuations the shifter must always leave air for (to make sure there
+// is enough air for claw locks when climbing): lock and release both claws
+#define AIR_CLAW_RESERVE 4
+// Dashboard dead-band and shortest time between updates of the air reserve
+#define AIR_RESERVE_EPSILON 1.0
+#define AIR_RESERVE_MIN_INTERVAL 0.5
 
 // Motor controller settings
 #define INDEXER_FWD 1.00
 
 #define SHOOTER_FWD 1.0
 #define ARM_DESCEND 0.2
-#define ARM_DESCEND_JOG 0.3
-#define ARM_CLIMB_JOG -0.3
 #define ARM_CLIMB -1.0
-#define CLIMB_LIMIT .5f
-#define DESCEND_LIMIT 4.5f
+
+// Arm position servo (see ArmController). Positions are arm pot volts, which
+// go down as the arm climbs; outputs are motor settings. KG is the output
+// that holds the arm up against gravity when it is level (at
+// ARM_LEVEL_VOLTS). Past ARM_SOFT_LIMIT_ZONE volts from a limit the output
+// toward it is scaled down to zero at the limit.
+// The gravity feed-forward is off until it has been measured on the robot.
+// Its sign, ARM_LEVEL_VOLTS (2.5 V is the center position, not known to be
+// level) and ARM_RADIANS_PER_VOLT are all unverified guesses; ARM_CLIMB and
+// ARM_DESCEND above suggest gravity resists the climb, in which case KG has
+// to be negative (toward lower pot volts).
+#define ARM_KP 2.0
+#define ARM_KI 0.5
+#define ARM_KD 0.05
+#define ARM_INTEGRAL_LIMIT 0.5
+#define ARM_KG 0.0
+#define ARM_LEVEL_VOLTS 2.5
+#define ARM_RADIANS_PER_VOLT 0.94
+#define ARM_SOFT_LIMIT_ZONE 0.3
+#define ARM_POSITION_TOLERANCE 0.05
+// Pot volts per dpad press, and the named positions (tune on the robot)
+#define ARM_JOG_STEP 0.25
+#define ARM_SETPOINT_CENTER 2.5
+#define ARM_SETPOINT_REACH 4.2
+#define ARM_SETPOINT_CLIMB 0.7
 
 // Define the target platfomr we are building for. We need this
 // because the hardware on Plyboy, WhamO-1 and WhamO-2 are 
-// all different from one another.
-// WHAMO1 is the competition bot
-// WHAMO2 is the test bot
-// PLYBOY is our development platform
-//#define PLYBOY
-#define WHAMO1
-//#define WHAMO2
-
-#ifdef PLYBOY
-#define NAME "Plyboy"
-#define LEFT_DRIVE_MOTOR Jaguar
-#define RIGHT_DRIVE_MOTOR Jaguar
-#define INDEXER_MOTOR_CONTROLLER Jaguar
-#define SHOOTER_MOTOR_CONTROLLER Jaguar
-#define ARM_MOTOR_CONTROLLER Jaguar
-#define GREEN_CLAW_LOCK_STATE (greenClawLockSwitch.GetState())
-#define YELLOW_CLAW_LOCK_STATE (yellowClawLockSwitch.GetState())
-#endif
-
-#ifdef WHAMO1
-#define NAME "WhamO-1"
-#define LEFT_DRIVE_MOTOR Victor
-#define RIGHT_DRIVE_MOTOR Victor
-#define INDEXER_MOTOR_CONTROLLER Jaguar
-#define SHOOTER_MOTOR_CONTROLLER Jaguar
-#define ARM_MOTOR_CONTROLLER Talon
-#define GREEN_CLAW_LOCK_STATE (!greenClawLockSwitch.GetState())
-#define YELLOW_CLAW_LOCK_STATE (!yellowClawLockSwitch.GetState())
-#endif
-
-#ifdef WHAMO2
-#define NAME "WhamO-2"
-#define LEFT_DRIVE_MOTOR Victor
-#define RIGHT_DRIVE_MOTOR Victor
-#define INDEXER_MOTOR_CONTROLLER Jaguar
-#define SHOOTER_MOTOR_CONTROLLER Jaguar
-#define ARM_MOTOR_CONTROLLER Victor
-#define GREEN_CLAW_LOCK_STATE (!greenClawLockSwitch.GetState())
-#define YELLOW_CLAW_LOCK_STATE (!yellowClawLockSwitch.GetState())
+// all different from one another (see RobotProfiles.h).
+// WhamO1Profile is the competition bot
+// WhamO2Profile is the test bot
+// PlyboyProfile is our development platform
+#ifndef ROBOT_PROFILE
+#define ROBOT_PROFILE WhamO1Profile
 #endif
 
 // Digital IOs
@@ -115,7 +139,7 @@ const step_speed m_autoForward[NUM_AUTONOMOUS_STEPS] =
 #define YELLOW_LOCK_SENSOR 6
 #define INDEXER_SW 7
 #define COMPRESSOR_PRESSURE_SW 8
-#define UNUSED_DIO_9 9
+#define SHOOTER_SPEED_SENSOR 9
 #define UNUSED_DIO_10 10
 #define UNUSED_DIO_11 11
 #define UNUSED_DIO_12 12
@@ -172,14 +196,14 @@ const step_speed m_autoForward[NUM_AUTONOMOUS_STEPS] =
 
 // Gamepad Buttons
 #define BUTTON_TOGGLE_SHOOTER 1
-#define UNUSED_BUTTON_2 2
-#define UNUSED_BUTTON_3 3
+#define BUTTON_ARM_REACH 2
+#define BUTTON_ARM_CLIMB 3
 #define BUTTON_INDEXER 4
 #define BUTTON_GREEN_CLAW_LOCKED 5
 #define BUTTON_YELLOW_CLAW_LOCKED 6
 #define BUTTON_GREEN_CLAW_UNLOCKED 7
 #define BUTTON_YELLOW_CLAW_UNLOCKED 8
-#define UNUSED_BUTTON_9 9
+#define BUTTON_ARM_CENTER 9
 #define BUTTON_STOP_ALL 10
 #define BUTTON_JOG_FWD 11
 #define BUTTON_JOG_REV 12
@@ -206,10 +230,90 @@ const step_speed m_autoForward[NUM_AUTONOMOUS_STEPS] =
 #define UNUSED_SOLENOID_8 8
 
 // Various Constants
-#define JOG_TIME 0.1
+// Teleop loop period in seconds (200 Hz). The loop runs on absolute
+// deadlines, so this is the real period and not a sleep after the work.
+#define TELEOP_LOOP_PERIOD 0.005
+// Autonomous loop period in seconds (see AutonomousEngine)
+#define AUTONOMOUS_LOOP_PERIOD 0.005
+// Longest the shooter is given to reach full speed from a stop, and to get
+// back up to speed after a disk. Autonomous fires as soon as ShooterSpeed
+// says the wheel is ready; these only matter if the speed sensor fails.
+#define SHOOTER_SPINUP_TIME 2.5
 #define RE_SPINUP_TIME 1.15
+// Shooter wheel speed sensor (one reflective stripe on the wheel). Pulses
+// further apart than the max period (seconds) count as stopped.
+#define SHOOTER_PULSES_PER_REV 1
+#define SHOOTER_MAX_PERIOD 0.1
+// Time constant (seconds) of the filter on the wheel speed
+#define SHOOTER_RPM_FILTER_TIME 0.03
+// Switch debounce (see EDigitalInput::SetDebounce): a change has to last
+// this many loop samples and this long (seconds) before it is acted on.
+// Well under the time the indexer switch stays open for one disk.
+#define INDEXER_SW_DEBOUNCE_SAMPLES 2
+#define INDEXER_SW_DEBOUNCE_TIME 0.01
+#define CLAW_SENSOR_DEBOUNCE_SAMPLES 2
+#define CLAW_SENSOR_DEBOUNCE_TIME 0.02
+// The wheel is ready to fire once it has held this speed for the hold time
+// (seconds). Tune against the wheel's real free speed.
+#define SHOOTER_READY_RPM 5400.0
+#define SHOOTER_READY_HOLD_TIME 0.1
+// Arm pot filter, run on the snapshot once per tick (see AnalogFilter): the
+// median of the last POT_MEDIAN_TAPS samples throws out spikes, then a first
+// order low pass (seconds) smooths what is left. Both are tuning defaults.
+#define POT_MEDIAN_TAPS 5
+#define POT_FILTER_TIME 0.02
 // A constant defining how significant a change in the value of the arm potentiometer
 // has to be for it to be sent to the driver station.
 #define POT_EPSILON 0.2f
+// SmartDashboard traffic limits. Changed values are sent together once per
+// flush period (seconds) and never at more than the byte budget, to keep the
+// network tables link from being swamped (see UpdateStatusDisplays).
+#define DASHBOARD_FLUSH_PERIOD 0.1
+#define DASHBOARD_BYTES_PER_SECOND 1000
+// Shortest time (seconds) between two updates of the arm potentiometer.
+#define POT_MIN_INTERVAL 0.25
+// Dead-band and shortest time between updates for the shooter wheel speed
+#define SHOOTER_RPM_EPSILON 100.0
+#define SHOOTER_RPM_MIN_INTERVAL 0.25
+// Shortest time between updates of the switch glitch count
+#define SWITCH_GLITCH_MIN_INTERVAL 1.0
+// The telemetry task sends queued dashboard and LCD output at the driver
+// station packet rate (seconds). vxWorks priorities run backwards, so the
+// higher number puts it below the robot main task (101).
+#define TELEMETRY_PERIOD 0.02
+#define TELEMETRY_TASK_PRIORITY 110
+// The LCD is only ever formatted and sent once per flush period (seconds),
+// the driver station packet rate
+#define LCD_FLUSH_PERIOD 0.02
+// Teleop task periods (seconds), each a whole number of TELEOP_LOOP_PERIODs
+// (see ScheduleTeleop). The inputs and events, and with them the indexer
+// stop, run every tick.
+#define DRIVE_TASK_PERIOD 0.005
+#define SHOOTER_TASK_PERIOD 0.005
+#define PNEUMATICS_TASK_PERIOD 0.005
+#define ARM_TASK_PERIOD 0.01
+#define DASHBOARD_TASK_PERIOD 0.1
+#define LCD_TASK_PERIOD 0.5
+// Longest each subsystem's Update should take (seconds); longer runs are
+// counted as overruns in the profiler dump (see Subsystem)
+#define DRIVE_UPDATE_BUDGET 0.0002
+#define ARM_UPDATE_BUDGET 0.0002
+#define SHOOTER_UPDATE_BUDGET 0.0001
+#define PNEUMATICS_UPDATE_BUDGET 0.0001
+// Every teleop period's inputs are recorded and written here when it ends
+// (see InputLog)
+#ifndef INPUT_LOG_FILE
+#define INPUT_LOG_FILE "inputs.log"
+#endif
+// Autonomous and teleop are logged tick by tick and written here when
+// teleop ends (see MatchLog)
+#ifndef MATCH_LOG_FILE
+#define MATCH_LOG_FILE "match.log"
+#endif
+// Tuning values that override the defaults above without a rebuild (see
+// ParameterStore). Read at startup and again whenever the robot is disabled.
+#ifndef TUNING_FILE
+#define TUNING_FILE "tuning.txt"
+#endif
 
 #endif
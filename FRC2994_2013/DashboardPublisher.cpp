@@ -0,0 +1,210 @@
+#include "DashboardPublisher.h"
+#include <string.h>
+
+DashboardPublisher::DashboardPublisher(TelemetryTask &telemetry, double flushPeriod, UINT32 bytesPerSecond):
+	m_telemetry(telemetry)
+{
+	for (UINT32 i = 0; i < DASHBOARD_MAX_KEYS; i++)
+	{
+		m_entries[i].type = kUnused;
+		m_entries[i].pending = false;
+		m_entries[i].everSent = false;
+	}
+
+	m_flushPeriod = (UINT32)(flushPeriod * 1e6);
+	m_bytesPerSecond = bytesPerSecond;
+
+	// Allow up to two flushes' worth of bytes to build up while nothing is
+	// queued, so a burst of changes after a quiet spell goes out at once
+	// but the long run rate stays at the budget.
+	m_maxBudget = 2.0 * flushPeriod * bytesPerSecond;
+	m_budget = m_maxBudget;
+	m_lastFlush = 0;
+	m_started = false;
+	m_nextKey = 0;
+
+	m_puts = 0;
+	m_bytesSent = 0;
+	m_coalesced = 0;
+	m_deferred = 0;
+}
+
+DashboardPublisher::~DashboardPublisher()
+{
+}
+
+bool DashboardPublisher::DefineNumber(UINT32 key, const char *name, double deadband, double minInterval)
+{
+	return Define(key, kNumber, name, sizeof(double), deadband, minInterval);
+}
+
+bool DashboardPublisher::DefineBoolean(UINT32 key, const char *name, double minInterval)
+{
+	return Define(key, kBoolean, name, 1, 0.0, minInterval);
+}
+
+bool DashboardPublisher::Define(UINT32 key, EntryType type, const char *name, UINT32 valueBytes,
+		double deadband, double minInterval)
+{
+	if (key >= DASHBOARD_MAX_KEYS || NULL == name)
+	{
+		return false;
+	}
+
+	Entry &entry = m_entries[key];
+	entry.type = type;
+	entry.name = name;
+	entry.deadband = deadband;
+	entry.minInterval = (UINT32)(minInterval * 1e6);
+	entry.cost = strlen(name) + valueBytes + DASHBOARD_ENTRY_OVERHEAD;
+	entry.everSent = false;
+	entry.pending = false;
+	entry.sent = 0.0;
+	entry.value = 0.0;
+	entry.lastSent = 0;
+
+	// A key that costs more than the budget can ever hold would never go out.
+	if (entry.cost > m_maxBudget)
+	{
+		m_maxBudget = entry.cost;
+	}
+	return true;
+}
+
+void DashboardPublisher::SetDeadband(UINT32 key, double deadband)
+{
+	if (key < DASHBOARD_MAX_KEYS && kNumber == m_entries[key].type)
+	{
+		m_entries[key].deadband = deadband;
+	}
+}
+
+void DashboardPublisher::SetNumber(UINT32 key, double value)
+{
+	Set(key, value);
+}
+
+void DashboardPublisher::SetBoolean(UINT32 key, bool value)
+{
+	Set(key, value ? 1.0 : 0.0);
+}
+
+void DashboardPublisher::Set(UINT32 key, double value)
+{
+	if (key >= DASHBOARD_MAX_KEYS || kUnused == m_entries[key].type)
+	{
+		return;
+	}
+
+	Entry &entry = m_entries[key];
+	double change = value - entry.sent;
+	if (change < 0.0)
+	{
+		change = -change;
+	}
+
+	if (!entry.everSent || change > entry.deadband)
+	{
+		if (entry.pending && entry.value != value)
+		{
+			m_coalesced++;
+		}
+		entry.value = value;
+		entry.pending = true;
+	}
+	else if (entry.pending)
+	{
+		// Back within the dead-band of what the dashboard already shows.
+		entry.pending = false;
+		m_coalesced++;
+	}
+}
+
+void DashboardPublisher::Invalidate()
+{
+	for (UINT32 i = 0; i < DASHBOARD_MAX_KEYS; i++)
+	{
+		m_entries[i].everSent = false;
+	}
+}
+
+void DashboardPublisher::Flush(UINT32 now)
+{
+	if (!m_started)
+	{
+		m_started = true;
+	}
+	else
+	{
+		// A quarter period early still counts, so a caller that flushes once
+		// per flush period is not put back a whole period by loop jitter.
+		INT32 elapsed = (INT32)(now - m_lastFlush);
+		if (elapsed < (INT32)(m_flushPeriod - m_flushPeriod / 4))
+		{
+			return;
+		}
+		m_budget += elapsed * (m_bytesPerSecond / 1e6);
+		if (m_budget > m_maxBudget)
+		{
+			m_budget = m_maxBudget;
+		}
+	}
+	m_lastFlush = now;
+
+	// Walk the keys round robin from the first one held back last time, so a
+	// tight budget is shared out rather than always spent on the low keys.
+	bool deferred = false;
+	UINT32 first = m_nextKey;
+	for (UINT32 i = 0; i < DASHBOARD_MAX_KEYS; i++)
+	{
+		UINT32 key = (first + i) % DASHBOARD_MAX_KEYS;
+		Entry &entry = m_entries[key];
+
+		if (!entry.pending)
+		{
+			continue;
+		}
+		if (entry.everSent && (INT32)(now - entry.lastSent) < (INT32)entry.minInterval)
+		{
+			continue;
+		}
+		if (entry.cost > m_budget)
+		{
+			if (!deferred)
+			{
+				deferred = true;
+				m_nextKey = key;
+			}
+			m_deferred++;
+			continue;
+		}
+
+		bool queued;
+		if (kNumber == entry.type)
+		{
+			queued = m_telemetry.PutNumber(entry.name, entry.value);
+		}
+		else
+		{
+			queued = m_telemetry.PutBoolean(entry.name, entry.value != 0.0);
+		}
+		if (!queued)
+		{
+			// Telemetry ring full: keep this and everything after it queued
+			// and start from here next time.
+			if (!deferred)
+			{
+				m_nextKey = key;
+			}
+			break;
+		}
+
+		entry.sent = entry.value;
+		entry.pending = false;
+		entry.everSent = true;
+		entry.lastSent = now;
+		m_budget -= entry.cost;
+		m_puts++;
+		m_bytesSent += entry.cost;
+	}
+}
@@ -0,0 +1,95 @@
+#ifndef DASHBOARDPUBLISHER_H_
+#define DASHBOARDPUBLISHER_H_
+
+#include "WPILib.h"
+#include "TelemetryTask.h"
+
+// Change-driven front end for the SmartDashboard. The loop hands it the
+// current value of every key each tick; only values that moved by more
+// than the key's dead-band are queued, and queued values are sent in one
+// flush per flush period. A key is never sent more often than its minimum
+// interval, and the whole publisher never sends more than its byte budget
+// per second. Anything held back stays queued (the newest value wins) and
+// goes out on a later flush. Values are handed to the telemetry task rather
+// than sent from the loop.
+
+// To use, define every key once with DefineNumber/DefineBoolean, call
+// SetNumber/SetBoolean as often as you like and call Flush every pass of
+// the loop, or at least once per flush period, with the current FPGA time.
+
+#define DASHBOARD_MAX_KEYS 16
+
+// Estimated network tables cost of one entry update on top of the key and
+// value: type, entry id and sequence number.
+#define DASHBOARD_ENTRY_OVERHEAD 5
+
+class DashboardPublisher
+{
+public:
+	// Periods in seconds.
+	DashboardPublisher(TelemetryTask &telemetry, double flushPeriod, UINT32 bytesPerSecond);
+	~DashboardPublisher();
+
+	bool DefineNumber(UINT32 key, const char *name, double deadband, double minInterval);
+	bool DefineBoolean(UINT32 key, const char *name, double minInterval);
+
+	// Change a number's dead-band (e.g. after retuning).
+	void SetDeadband(UINT32 key, double deadband);
+
+	void SetNumber(UINT32 key, double value);
+	void SetBoolean(UINT32 key, bool value);
+
+	// Forget what the dashboard has been sent, so the next Set of every key
+	// is queued whatever its value (e.g. at the start of a mode).
+	void Invalidate();
+
+	void Flush(UINT32 now);
+
+	// Statistics since construction.
+	UINT32 GetPutCount() { return m_puts; }
+	UINT32 GetBytesSent() { return m_bytesSent; }
+	// Queued values replaced or cancelled before they were sent.
+	UINT32 GetCoalescedCount() { return m_coalesced; }
+	// Queued values held back by the byte budget at a flush.
+	UINT32 GetDeferredCount() { return m_deferred; }
+
+private:
+	typedef enum
+	{
+		kUnused, kNumber, kBoolean
+	} EntryType;
+
+	typedef struct
+	{
+		EntryType type;
+		const char *name;
+		double deadband;
+		UINT32 minInterval;
+		UINT32 cost;
+		bool everSent;
+		bool pending;
+		double sent;
+		double value;
+		UINT32 lastSent;
+	} Entry;
+
+	bool Define(UINT32 key, EntryType type, const char *name, UINT32 valueBytes,
+			double deadband, double minInterval);
+	void Set(UINT32 key, double value);
+
+	TelemetryTask &m_telemetry;
+	Entry m_entries[DASHBOARD_MAX_KEYS];
+	UINT32 m_flushPeriod;
+	UINT32 m_bytesPerSecond;
+	double m_maxBudget;
+	double m_budget;
+	UINT32 m_lastFlush;
+	bool m_started;
+	UINT32 m_nextKey;
+
+	UINT32 m_puts;
+	UINT32 m_bytesSent;
+	UINT32 m_coalesced;
+	UINT32 m_deferred;
+};
+#endif
@@ -0,0 +1,87 @@
+#include "DriveController.h"
+#include "BasicDefines.h"
+#include <math.h>
+
+DriveController::DriveController(RobotDrive &drive):
+	m_drive(drive),
+	m_table(NULL),
+	m_segment(0),
+	m_distanceLoop(DRIVE_KP, DRIVE_KI, DRIVE_KD, DRIVE_INTEGRAL_LIMIT),
+	m_headingLoop(HEADING_KP, 0.0, HEADING_KD, 0.0),
+	m_running(false),
+	m_settled(false),
+	m_startTime(0),
+	m_lastTick(0),
+	m_startDistance(0.0),
+	m_targetHeading(0.0)
+{
+}
+
+DriveController::~DriveController()
+{
+}
+
+void DriveController::Start(UINT32 now, const DriveOdometry &odometry, const TrajectoryTable &table,
+		UINT32 segment)
+{
+	m_table = &table;
+	m_segment = segment;
+	m_distanceLoop.Reset();
+	m_headingLoop.Reset();
+	m_startTime = now;
+	m_lastTick = now;
+	m_startDistance = odometry.GetDistance();
+	m_targetHeading = odometry.GetHeading();
+	m_running = true;
+	m_settled = false;
+}
+
+bool DriveController::Tick(UINT32 now, const DriveOdometry &odometry)
+{
+	if (!m_running)
+	{
+		return true;
+	}
+
+	double elapsed = (INT32)(now - m_startTime) / 1e6;
+	double dt = (INT32)(now - m_lastTick) / 1e6;
+	m_lastTick = now;
+
+	double position;
+	double velocity;
+	double acceleration;
+	m_table->Sample(m_segment, elapsed, position, velocity, acceleration);
+
+	double travelled = odometry.GetDistance() - m_startDistance;
+	double positionError = position - travelled;
+	double velocityError = velocity - odometry.GetVelocity();
+
+	// Finished once the segment is over and the robot has come to rest at
+	// the end, or given up if it has not after the settle timeout.
+	double duration = m_table->GetDuration(m_segment);
+	if (elapsed >= duration)
+	{
+		m_settled = fabs(m_table->GetDistance(m_segment) - travelled) < DRIVE_POSITION_TOLERANCE &&
+			fabs(odometry.GetVelocity()) < DRIVE_VELOCITY_TOLERANCE;
+		if (m_settled || elapsed >= duration + DRIVE_SETTLE_TIMEOUT)
+		{
+			Stop();
+			return true;
+		}
+	}
+
+	double forward = DRIVE_KV * velocity + DRIVE_KA * acceleration +
+		m_distanceLoop.Calculate(positionError, velocityError, dt);
+	double turn = m_headingLoop.Calculate(m_targetHeading - odometry.GetHeading(),
+			-odometry.GetTurnRate(), dt);
+
+	// Positive heading is a turn to the left, so speed up the right side.
+	m_drive.SetLeftRightMotorOutputs(forward - turn, forward + turn);
+	return false;
+}
+
+void DriveController::Stop()
+{
+	m_drive.SetLeftRightMotorOutputs(0.0, 0.0);
+	m_running = false;
+}
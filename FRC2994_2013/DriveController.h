@@ -0,0 +1,51 @@
+#ifndef DRIVECONTROLLER_H_
+#define DRIVECONTROLLER_H_
+
+#include "WPILib.h"
+#include "DriveOdometry.h"
+#include "PIDLoop.h"
+#include "TrajectoryTable.h"
+
+// Closed loop straight moves for autonomous. Each move follows one segment
+// of a precomputed TrajectoryTable along the path: every pass the distance
+// loop drives toward the table's position (with its velocity and
+// acceleration as feed-forward) and the heading loop holds the heading the
+// move started on. The move ends once the segment is over and the robot
+// is within DRIVE_POSITION_TOLERANCE of the end and slower than
+// DRIVE_VELOCITY_TOLERANCE, or after DRIVE_SETTLE_TIMEOUT more if it never
+// settles.
+
+// To use, call Start with the move and then Tick every pass (after the
+// odometry has been updated) until it returns true.
+
+class DriveController
+{
+public:
+	explicit DriveController(RobotDrive &drive);
+	~DriveController();
+
+	// The table has to outlive the move.
+	void Start(UINT32 now, const DriveOdometry &odometry, const TrajectoryTable &table,
+			UINT32 segment);
+	bool Tick(UINT32 now, const DriveOdometry &odometry);
+	void Stop();
+
+	bool IsRunning() { return m_running; }
+	// Whether the last move ended inside the tolerances (rather than timing out).
+	bool IsSettled() { return m_settled; }
+
+private:
+	RobotDrive &m_drive;
+	const TrajectoryTable *m_table;
+	UINT32 m_segment;
+	PIDLoop m_distanceLoop;
+	PIDLoop m_headingLoop;
+
+	bool m_running;
+	bool m_settled;
+	UINT32 m_startTime;
+	UINT32 m_lastTick;
+	double m_startDistance;
+	double m_targetHeading;
+};
+#endif
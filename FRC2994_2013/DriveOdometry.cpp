@@ -0,0 +1,51 @@
+#include "DriveOdometry.h"
+#include "BasicDefines.h"
+#include <math.h>
+
+DriveOdometry::DriveOdometry():
+	m_lastLeft(0.0),
+	m_lastRight(0.0),
+	m_x(0.0),
+	m_y(0.0),
+	m_heading(0.0),
+	m_distance(0.0),
+	m_velocity(0.0),
+	m_turnRate(0.0)
+{
+}
+
+DriveOdometry::~DriveOdometry()
+{
+}
+
+void DriveOdometry::Reset(const InputSnapshot &inputs)
+{
+	m_lastLeft = inputs.leftDriveDistance;
+	m_lastRight = inputs.rightDriveDistance;
+	m_x = 0.0;
+	m_y = 0.0;
+	m_heading = 0.0;
+	m_distance = 0.0;
+	m_velocity = 0.0;
+	m_turnRate = 0.0;
+}
+
+void DriveOdometry::Update(const InputSnapshot &inputs)
+{
+	double left = inputs.leftDriveDistance - m_lastLeft;
+	double right = inputs.rightDriveDistance - m_lastRight;
+	m_lastLeft = inputs.leftDriveDistance;
+	m_lastRight = inputs.rightDriveDistance;
+
+	double travelled = 0.5 * (left + right);
+	double turned = (right - left) / DRIVE_TRACK_WIDTH;
+	double midHeading = m_heading + 0.5 * turned;
+
+	m_x += travelled * cos(midHeading);
+	m_y += travelled * sin(midHeading);
+	m_heading += turned;
+	m_distance += travelled;
+
+	m_velocity = 0.5 * (inputs.leftDriveRate + inputs.rightDriveRate);
+	m_turnRate = (inputs.rightDriveRate - inputs.leftDriveRate) / DRIVE_TRACK_WIDTH;
+}
@@ -0,0 +1,44 @@
+#ifndef DRIVEODOMETRY_H_
+#define DRIVEODOMETRY_H_
+
+#include "InputSnapshot.h"
+
+// Dead-reckoned pose of the robot from both drive encoders. Each update
+// moves the pose by the average of the two wheel distances and turns it by
+// their difference over the track width (DRIVE_TRACK_WIDTH), integrating
+// along the mid-step heading.
+
+// Positions are in inches from where Reset was called, the heading is in
+// radians (positive turns left) and distance is the signed distance
+// travelled along the path, which is what straight moves are measured by.
+
+class DriveOdometry
+{
+public:
+	DriveOdometry();
+	~DriveOdometry();
+
+	// Make the current position the origin, facing along x.
+	void Reset(const InputSnapshot &inputs);
+	void Update(const InputSnapshot &inputs);
+
+	double GetX() const { return m_x; }
+	double GetY() const { return m_y; }
+	double GetHeading() const { return m_heading; }
+	double GetDistance() const { return m_distance; }
+	// Rates from the encoder periods, which are much less noisy than
+	// differencing counts over one loop pass.
+	double GetVelocity() const { return m_velocity; }
+	double GetTurnRate() const { return m_turnRate; }
+
+private:
+	double m_lastLeft;
+	double m_lastRight;
+	double m_x;
+	double m_y;
+	double m_heading;
+	double m_distance;
+	double m_velocity;
+	double m_turnRate;
+};
+#endif
@@ -0,0 +1,46 @@
+#include "DriveSubsystem.h"
+#include "BasicDefines.h"
+
+DriveSubsystem::DriveSubsystem(RobotDrive &drive, bool reverseLeftEncoder,
+		bool reverseRightEncoder):
+	Subsystem("Drive", DRIVE_UPDATE_BUDGET),
+	m_drive(drive),
+	m_leftEncoder(LEFT_DRIVE_ENC_A, LEFT_DRIVE_ENC_B),
+	m_rightEncoder(RIGHT_DRIVE_ENC_A, RIGHT_DRIVE_ENC_B)
+{
+	m_leftEncoder.SetDistancePerPulse(DRIVE_ENCODER_DISTANCE_PER_PULSE);
+	m_leftEncoder.SetMaxPeriod(1.0);
+	m_leftEncoder.SetReverseDirection(reverseLeftEncoder);
+	m_leftEncoder.Start();
+
+	m_rightEncoder.SetDistancePerPulse(DRIVE_ENCODER_DISTANCE_PER_PULSE);
+	m_rightEncoder.SetMaxPeriod(1.0);
+	m_rightEncoder.SetReverseDirection(reverseRightEncoder);
+	m_rightEncoder.Start();
+}
+
+DriveSubsystem::~DriveSubsystem()
+{
+}
+
+void DriveSubsystem::ReadInputs(InputSnapshot &inputs)
+{
+	// Encoder::Get is already scaled to single pulses, which is what
+	// the distance per pulse is given in.
+	inputs.leftDriveCount = m_leftEncoder.Get();
+	inputs.rightDriveCount = m_rightEncoder.Get();
+	inputs.leftDriveDistance = inputs.leftDriveCount * DRIVE_ENCODER_DISTANCE_PER_PULSE;
+	inputs.rightDriveDistance = inputs.rightDriveCount * DRIVE_ENCODER_DISTANCE_PER_PULSE;
+	inputs.leftDriveRate = m_leftEncoder.GetRate();
+	inputs.rightDriveRate = m_rightEncoder.GetRate();
+}
+
+void DriveSubsystem::Update(const InputSnapshot &inputs)
+{
+	m_drive.ArcadeDrive(inputs.stickY, inputs.stickX);
+}
+
+void DriveSubsystem::Stop()
+{
+	m_drive.StopMotor();
+}
@@ -0,0 +1,27 @@
+#ifndef DRIVESUBSYSTEM_H_
+#define DRIVESUBSYSTEM_H_
+
+#include "WPILib.h"
+#include "Subsystem.h"
+
+// The drive base: arcade drive from joystick one in teleop, and the two
+// drive shaft encoders, reversed as the profile says so that both count up
+// driving forward. The drive motors and RobotDrive are the profile's
+// and stay with the robot; autonomous drives through DriveController.
+
+class DriveSubsystem : public Subsystem
+{
+public:
+	DriveSubsystem(RobotDrive &drive, bool reverseLeftEncoder, bool reverseRightEncoder);
+	~DriveSubsystem();
+
+	void ReadInputs(InputSnapshot &inputs);
+	void Update(const InputSnapshot &inputs);
+	void Stop();
+
+private:
+	RobotDrive &m_drive;
+	Encoder m_leftEncoder;
+	Encoder m_rightEncoder;
+};
+#endif
@@ -1,19 +1,28 @@
 #include "EAnalogTrigger.h"
 
 EAnalogTrigger::EAnalogTrigger(UINT32 channel):
-	AnalogTrigger(channel)
+	AnalogTrigger(channel),
+	m_lower(0.0f),
+	m_upper(0.0f),
+	m_state(false)
 {
 	Initialize();
 };
 
 EAnalogTrigger::EAnalogTrigger(UINT8 moduleNumber, UINT32 channel):
-	AnalogTrigger(moduleNumber, channel)
+	AnalogTrigger(moduleNumber, channel),
+	m_lower(0.0f),
+	m_upper(0.0f),
+	m_state(false)
 {
 	Initialize();
 };
 
 EAnalogTrigger::EAnalogTrigger(AnalogChannel *channel):
-		AnalogTrigger(channel)
+		AnalogTrigger(channel),
+	m_lower(0.0f),
+	m_upper(0.0f),
+	m_state(false)
 {
 	Initialize();
 }
@@ -22,48 +31,31 @@ EAnalogTrigger::~EAnalogTrigger()
 {
 }
 
-EventType EAnalogTrigger::GetEvent()
+void EAnalogTrigger::Initialize()
 {
+	m_events.Enable(EEVENT_SINGLE_INPUT);
+	SetHysteresis(1.0, 4.0);
+	SetAveraged(false);
+	SetFiltered(false);
 	
-	return m_trigger.event;
 }
 
-StateType EAnalogTrigger::GetState()
+void EAnalogTrigger::SetHysteresis(float lower, float upper)
 {
-	
-	return m_trigger.state;
+	SetLimitsVoltage(lower, upper);
+	m_lower = lower;
+	m_upper = upper;
 }
 
-void EAnalogTrigger::Update()
+void EAnalogTrigger::Update(float volts)
 {
-	StateType newState;
-	
-	newState = GetTriggerState() ? kStateOpen : kStateClosed;
-	if (newState == m_trigger.state)
+	if (volts > m_upper)
 	{
-		m_trigger.event = kEventNone;
+		m_state = true;
 	}
-	else
+	else if (volts < m_lower)
 	{
-		if (kStateClosed == newState)
-		{
-			m_trigger.event = kEventClosed;
-		}
-		else
-		{
-			m_trigger.event = kEventOpened;
-		}
-		m_trigger.state = newState;
+		m_state = false;
 	}
-}
-
-void EAnalogTrigger::Initialize()
-{
-	m_trigger.enabled = false;
-	m_trigger.event = kEventErr;
-	m_trigger.state = kStateErr;
-	SetLimitsVoltage(1.0, 4.0);
-	SetAveraged(false);
-	SetFiltered(false);
-	
+	m_events.Update((UINT8)m_state);
 }
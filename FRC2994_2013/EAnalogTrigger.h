@@ -5,8 +5,16 @@
 #include "WPILib.h"
 #include "AnalogTrigger.h"
 #include "BasicDefines.h"
+#include "EEventCore.h"
 
+// The trigger state is true (open) above the upper limit and false below
+// the lower one; in between it holds, so a signal wandering around one
+// threshold does not chatter.
 
+// Update() takes the state from the FPGA trigger, which sees the raw
+// channel. Update(volts) applies the same limits in software to a voltage
+// the loop has already filtered (see AnalogFilter), so a single-sample
+// spike on the channel cannot produce an event.
 
 class EAnalogTrigger : public AnalogTrigger
 {
@@ -16,13 +24,20 @@ public:
 	EAnalogTrigger(AnalogChannel *channel);
 	~EAnalogTrigger();
 	
-	EventType GetEvent();
-	StateType GetState();
-	void Update();
+	EventType GetEvent() { return m_events.GetEvent(EEVENT_SINGLE_INPUT); }
+	StateType GetState() { return m_events.GetState(EEVENT_SINGLE_INPUT); }
+	void Update() { m_events.Update((UINT8)GetTriggerState()); }
+	void Update(float volts);
+	
+	// Sets the FPGA limits and the software ones together.
+	void SetHysteresis(float lower, float upper);
 	
 private: 
 	void Initialize();
 	
-	ButtonEntry m_trigger;
+	EEventCore<UINT8, false> m_events;
+	float m_lower;
+	float m_upper;
+	bool m_state;
 };
 #endif
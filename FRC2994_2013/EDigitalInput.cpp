@@ -1,13 +1,21 @@
 #include "EDigitalInput.h"
 
 EDigitalInput::EDigitalInput(UINT32 channel):
-	DigitalInput(channel)
+	DigitalInput(channel),
+	m_edgeLevel(false),
+	m_stopMotor(NULL),
+	m_maxStopLatency(0),
+	m_resumeOutput(0.0f)
 {
 	Initialize();
 };
 
 EDigitalInput::EDigitalInput(UINT8 moduleNumber, UINT32 channel):
-	DigitalInput(moduleNumber, channel)
+	DigitalInput(moduleNumber, channel),
+	m_edgeLevel(false),
+	m_stopMotor(NULL),
+	m_maxStopLatency(0),
+	m_resumeOutput(0.0f)
 {
 	Initialize();
 };
@@ -16,46 +24,115 @@ EDigitalInput::~EDigitalInput()
 {
 };
 
-EventType EDigitalInput::GetEvent()
+void EDigitalInput::Initialize()
 {
-	
-	//Disabled buttons are initialized to kEventErr
-	return m_button.event;
+	// The state stays kStateErr (and the event kEventErr) until the first
+	// Update
+	m_events.Enable(EEVENT_SINGLE_INPUT);
 }
 
-StateType EDigitalInput::GetState()
+void EDigitalInput::SetDebounce(UINT32 samples, double seconds)
 {
-	return m_button.state;
+	m_events.SetDebounce(samples, (UINT32)(seconds * 1e6));
 }
 
-void EDigitalInput::Update()
+void EDigitalInput::Update(bool value)
 {
-	StateType newState;
-	
-			newState = Get() ? kStateOpen: kStateClosed;
-			if (newState == m_button.state)
-			{
-				m_button.event = kEventNone;
-			}
-			else
-			{
-				if (kStateClosed == newState)
-				{
-					m_button.event = kEventClosed;
-				}
-				else
-				{
-					m_button.event = kEventOpened;
-				}
-				m_button.state = newState;
-			}
+	m_events.Update((UINT8)value);
+	Resume(value);
 }
 
+void EDigitalInput::Update(bool value, UINT32 now)
+{
+	m_events.Update((UINT8)value, now);
+	Resume(value);
+}
 
-void EDigitalInput::Initialize()
+void EDigitalInput::SetStopAction(SpeedController *motor)
 {
-	m_button.enabled = false;
-	m_button.event = kEventErr;
-	m_button.state = kStateErr;
-	
+	m_stopMotor = motor;
+}
+
+bool EDigitalInput::GetEdge(EDigitalEdge &edge)
+{
+	if (!m_edges.Pop(edge))
+	{
+		return false;
+	}
+	if (0.0f != edge.stoppedOutput)
+	{
+		m_resumeOutput = edge.stoppedOutput;
+	}
+	return true;
+}
+
+// Put back a motor the handler stopped for what turned out to be a glitch:
+// the switch reads closed again and the debounced state never opened. A
+// debounced opening means the stop was meant.
+void EDigitalInput::Resume(bool value)
+{
+	if (0.0f == m_resumeOutput)
+	{
+		return;
+	}
+	if (kEventOpened == GetEvent())
+	{
+		m_resumeOutput = 0.0f;
+	}
+	else if (!value && kStateClosed == GetState())
+	{
+		m_stopMotor->Set(m_resumeOutput);
+		m_resumeOutput = 0.0f;
+	}
+}
+
+void EDigitalInput::RequestEdges()
+{
+	m_edgeLevel = (0 != Get());
+	RequestInterrupts(InterruptHandler, this);
+	SetUpSourceEdge(true, true);
+	EnableInterrupts();
+}
+
+void EDigitalInput::InterruptHandler(UINT32 interruptAssertedMask, void *param)
+{
+	((EDigitalInput *)param)->HandleEdge();
+}
+
+// Runs in the interrupt task, so it only touches the producer side of the
+// queue, the motor (to stop it) and the latency figure.
+void EDigitalInput::HandleEdge()
+{
+	UINT32 timestamp = (UINT32)(ReadInterruptTimestamp() * 1e6);
+	bool value = (0 != Get());
+	if (value == m_edgeLevel)
+	{
+		// The input went back before we got to read it, so there is
+		// nothing left to act on.
+		return;
+	}
+	m_edgeLevel = value;
+
+	EDigitalEdge edge;
+	edge.timestamp = timestamp;
+	edge.value = value;
+	edge.stoppedOutput = 0.0f;
+
+	if (value && NULL != m_stopMotor)
+	{
+		float output = m_stopMotor->Get();
+		if (0.0f != output)
+		{
+			m_stopMotor->Set(0.0f);
+			edge.stoppedOutput = output;
+
+			UINT32 latency = GetFPGATime() - timestamp;
+			if (latency > m_maxStopLatency)
+			{
+				m_maxStopLatency = latency;
+			}
+		}
+	}
+
+	m_edges.Push(edge);
 }
@@ -5,10 +5,44 @@
 #include "WPILib.h"
 #include "DigitalInput.h"
 #include "BasicDefines.h"
+#include "EEventCore.h"
+#include "SpscRing.h"
+
+// Edges queued by the interrupt handler (size must be a power of two)
+#define EDIGITALINPUT_EDGE_QUEUE_SIZE 16
 
 // To use, call the initialize method once before you enter your main program
 // loop then call the update method once per loop
 
+// The input reads high (true) when the switch is open.
+
+// SetDebounce makes a change wait out switch bounce and vibration before
+// it is reported: it has to last for the given number of Updates and
+// seconds (see EEventCore). Rejected changes are counted.
+
+// RequestEdges adds an interrupt mode next to the polling: the FPGA
+// interrupts on both edges, and the handler (in the interrupt task, not
+// the loop) timestamps each edge and queues it for the loop to read with
+// GetEdge. SetStopAction has the handler stop a motor the moment the switch
+// opens, rather than up to a loop period later when the loop gets to it.
+// Setting the motor to zero is all the handler does to it; the edge it
+// queues carries the output it cut. Putting the motor back is left to the
+// loop: once the edges have been read, an Update that finds the switch
+// closed again without the debounced state ever having opened (a glitch)
+// restores the output, unless the loop has stopped the motor on purpose
+// since and said so with CancelResume. The events the loop acts on still
+// come from Update, so the debounce still applies to them.
+
+// The handler and the loop can still both set the motor at once (a stop
+// as the loop starts the indexer); the loop's write then wins, and the
+// debounced opening stops the motor a tick or two later, as polling would.
+
+typedef struct
+{
+	UINT32 timestamp;                // FPGA time of the edge (us)
+	bool value;                      // level after it (true is open)
+	float stoppedOutput;             // output the stop action cut, or 0
+} EDigitalEdge;
 
 class EDigitalInput : public DigitalInput
 {
@@ -17,13 +51,49 @@ public:
 	 EDigitalInput(UINT8 moduleNumber, UINT32 channel);
 	~EDigitalInput();
 
-	EventType GetEvent();
-	StateType GetState();
-	void Update();
+	EventType GetEvent() { return m_events.GetEvent(EEVENT_SINGLE_INPUT); }
+	StateType GetState() { return m_events.GetState(EEVENT_SINGLE_INPUT); }
+	void Update() { Update(Get()); }
+	// Update from a value already sampled (see InputSnapshot), at the time
+	// it was sampled
+	void Update(bool value);
+	void Update(bool value, UINT32 now);
+	// Take the state without reporting an event for it
+	void Prime(bool value) { m_events.Prime((UINT8)value); }
+	
+	void SetDebounce(UINT32 samples, double seconds);
+	UINT32 GetGlitchCount() { return m_events.GetGlitchCount(); }
+	// The edges found by the last Update, for EventDispatcher (the switch
+	// is EEVENT_SINGLE_INPUT)
+	const EEventCore<UINT8, false> &GetEvents() const { return m_events; }
+	
+	// Interrupt mode. Set the stop action before requesting the edges, and
+	// read every edge with GetEdge before the Update for the tick.
+	void SetStopAction(SpeedController *motor);
+	void RequestEdges();
+	bool GetEdge(EDigitalEdge &edge);
+	// The loop has stopped the motor itself, so a stop the handler made
+	// is not to be undone
+	void CancelResume() { m_resumeOutput = 0.0f; }
+	UINT32 GetDroppedEdgeCount() { return m_edges.GetDroppedCount(); }
+	// Longest time from an edge to the stop action running (us)
+	UINT32 GetMaxStopLatency() { return m_maxStopLatency; }
 	
 private: 
 	void Initialize();
+	static void InterruptHandler(UINT32 interruptAssertedMask, void *param);
+	void HandleEdge();
+	void Resume(bool value);
+	
+	EEventCore<UINT8, false> m_events;
+	
+	// Interrupt task side
+	SpscRing<EDigitalEdge, EDIGITALINPUT_EDGE_QUEUE_SIZE> m_edges;
+	bool m_edgeLevel;
+	SpeedController *m_stopMotor;
+	volatile UINT32 m_maxStopLatency;
 	
-	ButtonEntry m_button;
+	// Loop side
+	float m_resumeOutput;
 };
 #endif
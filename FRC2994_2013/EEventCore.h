@@ -0,0 +1,191 @@
+#ifndef EEVENTCORE_H_
+#define EEVENTCORE_H_
+
+#include "WPILib.h"
+#include "BasicDefines.h"
+
+// Open/closed state and event detection shared by EDigitalInput,
+// EAnalogTrigger, EJoystick and EGamepad.
+
+// The core tracks a word of contacts, one per bit (a single input just
+// uses bit 0). Each wrapper samples its source and hands the raw word to
+// Update; ClosedWhenHigh says whether a set bit means closed (buttons) or
+// open (switches read through a pull-up, analog triggers). The polarity is
+// a constant mask XOR chosen at compile time, so there is no per-sample
+// branch on it.
+
+// A contact is "known" once it has a state (Prime reads every contact,
+// otherwise the first Update does) and "sampled" once an Update has run
+// with it enabled. Unknown contacts report kStateErr, unsampled ones
+// kEventErr. The first Update of an unknown contact reports an event for
+// the state it finds, as the original per-class code did.
+
+// Debouncing is off unless SetDebounce is called. With it on, a change of
+// a known contact is only accepted once it has been seen on at least the
+// given number of consecutive Updates and for at least the given time;
+// a change that goes away before then is a glitch, and is counted instead
+// of being reported. The wait is kept for the word as a whole, so a second
+// contact changing restarts it for the first. That suits the single
+// inputs it is meant for; the driver station words are left undebounced.
+
+template <typename Word, bool ClosedWhenHigh>
+class EEventCore
+{
+public:
+	EEventCore():
+		m_enabled(0),
+		m_known(0),
+		m_sampled(0),
+		m_state(0),
+		m_closed(0),
+		m_opened(0),
+		m_debounceSamples(0),
+		m_debounceTime(0),
+		m_candidate(0),
+		m_candidateCount(0),
+		m_candidateSince(0),
+		m_glitches(0)
+	{
+	}
+
+	// Samples and microseconds a change has to last; 0, 0 turns it off.
+	void SetDebounce(UINT32 samples, UINT32 time)
+	{
+		m_debounceSamples = samples;
+		m_debounceTime = time;
+		m_candidate = 0;
+	}
+
+	void Enable(Word mask)
+	{
+		m_enabled |= mask;
+	}
+
+	// Take an initial reading of every contact without reporting events.
+	void Prime(Word raw)
+	{
+		m_state = ToClosed(raw);
+		m_known = (Word)~0;
+		m_sampled = m_enabled;
+		m_closed = 0;
+		m_opened = 0;
+		m_candidate = 0;
+	}
+
+	// The time (FPGA microseconds) is only used when there is a debounce
+	// time; Update(raw) reads the clock itself if it is needed.
+	void Update(Word raw)
+	{
+		Update(raw, m_debounceTime > 0 ? GetFPGATime() : 0);
+	}
+
+	void Update(Word raw, UINT32 now)
+	{
+		Word closed = ToClosed(raw);
+		if (m_debounceSamples > 1 || m_debounceTime > 0)
+		{
+			closed = Debounce(closed, now);
+		}
+		Word changed = (Word)(((closed ^ m_state) | (Word)~m_known) & m_enabled);
+
+		m_closed = (Word)(changed & closed);
+		m_opened = (Word)(changed & (Word)~closed);
+		m_state = (Word)((m_state & (Word)~m_enabled) | (closed & m_enabled));
+		m_known |= m_enabled;
+		m_sampled = m_enabled;
+	}
+
+	EventType GetEvent(Word mask) const
+	{
+		if (!(m_sampled & mask))
+		{
+			return kEventErr;
+		}
+		if (m_closed & mask)
+		{
+			return kEventClosed;
+		}
+		if (m_opened & mask)
+		{
+			return kEventOpened;
+		}
+		return kEventNone;
+	}
+
+	StateType GetState(Word mask) const
+	{
+		if (!(m_known & mask))
+		{
+			return kStateErr;
+		}
+		return (m_state & mask) ? kStateClosed : kStateOpen;
+	}
+
+	// Whole-word views for callers that want to act on every edge at once.
+	Word GetClosedMask() const { return m_closed; }
+	Word GetOpenedMask() const { return m_opened; }
+	Word GetChangedMask() const { return (Word)(m_closed | m_opened); }
+	Word GetStateMask() const { return m_state; }
+
+	// Changes rejected by the debounce since construction.
+	UINT32 GetGlitchCount() const { return m_glitches; }
+
+private:
+	static const Word kInvert = ClosedWhenHigh ? (Word)0 : (Word)~(Word)0;
+
+	static Word ToClosed(Word raw)
+	{
+		return (Word)(raw ^ kInvert);
+	}
+
+	// The closed word to act on: known contacts keep their state until a
+	// change has lasted long enough, unknown ones take what was read.
+	Word Debounce(Word closed, UINT32 now)
+	{
+		Word differs = (Word)((closed ^ m_state) & m_known & m_enabled);
+		if (differs != m_candidate)
+		{
+			Word dropped = (Word)(m_candidate & (Word)~differs);
+			while (dropped)
+			{
+				m_glitches++;
+				dropped &= (Word)(dropped - 1);
+			}
+			m_candidate = differs;
+			m_candidateCount = 0;
+			m_candidateSince = now;
+		}
+
+		Word accepted = 0;
+		if (m_candidate)
+		{
+			m_candidateCount++;
+			if (m_candidateCount >= m_debounceSamples &&
+				(INT32)(now - m_candidateSince) >= (INT32)m_debounceTime)
+			{
+				accepted = m_candidate;
+				m_candidate = 0;
+			}
+		}
+		return (Word)(((m_state ^ accepted) & m_known) | (closed & (Word)~m_known));
+	}
+
+	Word m_enabled;
+	Word m_known;
+	Word m_sampled;
+	Word m_state;
+	Word m_closed;
+	Word m_opened;
+
+	UINT32 m_debounceSamples;
+	UINT32 m_debounceTime;
+	Word m_candidate;                // contacts waiting out the debounce
+	UINT32 m_candidateCount;
+	UINT32 m_candidateSince;
+	UINT32 m_glitches;
+};
+
+// Single contact inputs use bit 0 of a byte.
+#define EEVENT_SINGLE_INPUT ((UINT8)1)
+
+#endif
@@ -3,7 +3,9 @@
 
 #include "WPILib.h"
 #include "Gamepad.h"
+#include "DriverStation.h"
 #include "BasicDefines.h"
+#include "EEventCore.h"
 
 #define EGAMEPAD_NUM_BUTTONS 12
 // This class extends the Gamepad class to provide button event detection
@@ -15,24 +17,80 @@
 // and check for a state change (an "event" closed->open or open->closd)
 // using GetEvent.
 
+// Update reads the whole button word from the driver station once and
+// finds every edge with a couple of bitwise operations (see EEventCore);
+// GetEvent and GetState are single bit tests.
+
 class EGamepad : public Gamepad
 {
 public:
 	explicit EGamepad(UINT32 port);
 	~EGamepad();
 
-	EventType GetEvent(int buttonNumber);
-	StateType GetState(int buttonNumber);
-	EventType EGamepad::GetDPadEvent(Gamepad::DPadDirection direction);
-	StateType EGamepad::GetDPadState(Gamepad::DPadDirection direction);
+	EventType GetEvent(int buttonNumber)
+	{
+		if (buttonNumber < 1 || buttonNumber > EGAMEPAD_NUM_BUTTONS)
+		{
+			return kEventErr;
+		}
+		// Disabled buttons report kEventErr (just sayin')
+		return m_buttons.GetEvent((UINT16)(1 << (buttonNumber - 1)));
+	}
+
+	StateType GetState(int buttonNumber)
+	{
+		if (buttonNumber < 1 || buttonNumber > EGAMEPAD_NUM_BUTTONS)
+		{
+			return kStateErr;
+		}
+		// Disabled buttons keep the state read at initialization
+		return m_buttons.GetState((UINT16)(1 << (buttonNumber - 1)));
+	}
+
+	EventType GetDPadEvent(Gamepad::DPadDirection direction)
+	{
+		return m_dpad.GetEvent((UINT16)(1 << direction));
+	}
+
+	StateType GetDPadState(Gamepad::DPadDirection direction)
+	{
+		return m_dpad.GetState((UINT16)(1 << direction));
+	}
+
+	void Update()
+	{
+		Update(GetButtonWord(), GetDPad());
+	}
+
+	// Update from values already sampled (see InputSnapshot)
+	void Update(UINT16 buttons, Gamepad::DPadDirection dpad)
+	{
+		m_buttons.Update(buttons);
+		// Only one DPad direction can be closed at a time, so the DPad is a
+		// one-hot word indexed by direction.
+		m_dpad.Update((UINT16)(1 << dpad));
+	}
+
+	UINT16 GetButtonWord()
+	{
+		return (UINT16)ap_ds->GetStickButtons(a_port);
+	}
 
-	void Update();
 	bool EnableButton(int buttonNumber);
 	
+	// The edges found by the last Update, for EventDispatcher, and the bit
+	// of each contact in them.
+	const EEventCore<UINT16, true> &GetButtonEvents() const { return m_buttons; }
+	const EEventCore<UINT16, true> &GetDPadEvents() const { return m_dpad; }
+	static UINT16 ButtonMask(int buttonNumber) { return (UINT16)(1 << (buttonNumber - 1)); }
+	static UINT16 DPadMask(Gamepad::DPadDirection direction) { return (UINT16)(1 << direction); }
+	
 private: 
 	void Initialize();
 	
-	ButtonEntry m_buttonTable[EGAMEPAD_NUM_BUTTONS+1];
-	ButtonEntry m_dpadTable[Gamepad::kUpRight+1];
+	// Button n is bit n-1 of the button word, as sent by the driver
+	// station. DPad direction d is bit d of the DPad word.
+	EEventCore<UINT16, true> m_buttons;
+	EEventCore<UINT16, true> m_dpad;
 };
 #endif
@@ -4,6 +4,7 @@
 EJoystick::EJoystick(UINT32 port):
 	Joystick(port)
 {
+	m_port = port;
 	Initialize();
 };
 
@@ -14,61 +15,10 @@ EJoystick::~EJoystick()
 EJoystick::EJoystick(UINT32 port, UINT32 numAxisTypes, UINT32 numButtonTypes):
 		Joystick(port, numAxisTypes, numButtonTypes)
 {
+	m_port = port;
 	Initialize();
 };
 
-EventType EJoystick::GetEvent(int buttonNumber)
-{
-	if (buttonNumber < 1 || buttonNumber > EJOYSTICK_NUM_BUTTONS)
-	{
-		return kEventErr;
-	}
-	
-	//Disabled buttons are initialized to kEventErr
-	return m_buttonTable[buttonNumber].event;
-}
-
-StateType EJoystick::GetState(int buttonNumber)
-{
-	if (buttonNumber < 1 || buttonNumber > EJOYSTICK_NUM_BUTTONS)
-	{
-		return kStateErr;
-	}
-	
-	//Disabled buttons are initialized to kStateErr
-	return m_buttonTable[buttonNumber].state;
-}
-
-void EJoystick::Update()
-{
-	StateType newState;
-	
-	for (int i=1; i<=EJOYSTICK_NUM_BUTTONS; i++)
-	{
-		if (true == m_buttonTable[i].enabled)
-		{
-			newState = GetRawButton(i) ? kStateClosed : kStateOpen;
-			if (newState == m_buttonTable[i].state)
-			{
-				m_buttonTable[i].event = kEventNone;
-			}
-			else
-			{
-				if (kStateClosed == newState)
-				{
-					m_buttonTable[i].event = kEventClosed;
-				}
-				else
-				{
-					m_buttonTable[i].event = kEventOpened;
-				}
-				m_buttonTable[i].state = newState;
-			}
-		}
-	}
-}
-
-
 bool EJoystick::EnableButton(int buttonNumber)
 {
 	if (buttonNumber < 1 || buttonNumber > EJOYSTICK_NUM_BUTTONS)
@@ -76,20 +26,13 @@ bool EJoystick::EnableButton(int buttonNumber)
 		return false;
 	}
 	
-	m_buttonTable[buttonNumber].enabled = true;
+	m_buttons.Enable((UINT16)(1 << (buttonNumber - 1)));
 	return true;
 }
 
 void EJoystick::Initialize()
 {
-	m_buttonTable[0].enabled = false;
-	m_buttonTable[0].event = kEventErr;
-	m_buttonTable[0].state = kStateErr;
-	
-	for (int i=1; i<=EJOYSTICK_NUM_BUTTONS; i++)
-	{
-		m_buttonTable[i].enabled = false;
-		m_buttonTable[i].event = kEventErr;
-		m_buttonTable[i].state = GetRawButton(i) ? kStateClosed : kStateOpen;
-	}
+	m_ds = DriverStation::GetInstance();
+	m_buttons.Prime((UINT16)m_ds->GetStickButtons(m_port));
 }
+
@@ -3,7 +3,13 @@
 
 #define EJOYSTICK_NUM_BUTTONS 11
 #include "WPILib.h"
+#include "DriverStation.h"
 #include "BasicDefines.h"
+#include "EEventCore.h"
+
+// Button event detection for a joystick. Works the same way as EGamepad:
+// one read of the button word per Update, edges found by EEventCore, and
+// GetEvent/GetState answered from bit tests.
 
 class EJoystick : public Joystick
 {
@@ -12,15 +18,57 @@ public:
 	EJoystick(UINT32 port, UINT32 numAxisTypes, UINT32 numButtonTypes);
 	virtual ~EJoystick();
 
-	EventType GetEvent(int buttonNumber);
-	StateType GetState(int buttonNumber);
-	void Update();
+	EventType GetEvent(int buttonNumber)
+	{
+		if (buttonNumber < 1 || buttonNumber > EJOYSTICK_NUM_BUTTONS)
+		{
+			return kEventErr;
+		}
+		//Disabled buttons report kEventErr
+		return m_buttons.GetEvent((UINT16)(1 << (buttonNumber - 1)));
+	}
+
+	StateType GetState(int buttonNumber)
+	{
+		if (buttonNumber < 1 || buttonNumber > EJOYSTICK_NUM_BUTTONS)
+		{
+			return kStateErr;
+		}
+		//Disabled buttons keep the state read at initialization
+		return m_buttons.GetState((UINT16)(1 << (buttonNumber - 1)));
+	}
+
+	void Update()
+	{
+		Update(GetButtonWord());
+	}
+
+	// Update from a button word already sampled (see InputSnapshot)
+	void Update(UINT16 buttons)
+	{
+		m_buttons.Update(buttons);
+	}
+
+	UINT16 GetButtonWord()
+	{
+		return (UINT16)m_ds->GetStickButtons(m_port);
+	}
+
 	bool EnableButton(int buttonNumber);
 	
+	// The edges found by the last Update, for EventDispatcher, and the bit
+	// of each button in them.
+	const EEventCore<UINT16, true> &GetButtonEvents() const { return m_buttons; }
+	static UINT16 ButtonMask(int buttonNumber) { return (UINT16)(1 << (buttonNumber - 1)); }
+	
 	
 private: 
 	void Initialize();
 	
-	ButtonEntry m_buttonTable[EJOYSTICK_NUM_BUTTONS+1];
+	// Joystick keeps its driver station and port to itself, so we hold our
+	// own to read the button word directly. Button n is bit n-1.
+	DriverStation *m_ds;
+	UINT32 m_port;
+	EEventCore<UINT16, true> m_buttons;
 };
 #endif
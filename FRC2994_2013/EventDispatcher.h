@@ -0,0 +1,142 @@
+#ifndef EVENTDISPATCHER_H_
+#define EVENTDISPATCHER_H_
+
+#include "WPILib.h"
+#include "BasicDefines.h"
+
+// Table of (source, contact, edge) -> action bindings, dispatched from the
+// edge masks of the event layer (see EEventCore) instead of asking every
+// bound button for its event every tick.
+
+// A source is one event word: a gamepad's buttons, its DPad, a joystick's
+// buttons, a switch. Bind records an action for a contact's closed or
+// opened edge; the contact is given as its bit in the source's word (the
+// E* classes' mask helpers), and a contact can have several actions, run
+// in the order they were bound. Dispatch, once per tick after the source's
+// Update, masks the edges that occurred with the contacts that have
+// bindings and runs the actions for each one left, lowest bit first. A
+// tick with no bound edges costs two ANDs per source, and every edge that
+// did occur is delivered, however many there are.
+
+// Actions are member functions of the Target (the robot) taking no
+// arguments.
+
+#define EVENT_DISPATCHER_MAX_SOURCES 4
+#define EVENT_DISPATCHER_MAX_BINDINGS 24
+#define EVENT_DISPATCHER_MAX_CONTACTS 16
+
+template <class Target>
+class EventDispatcher
+{
+public:
+	typedef void (Target::*Action)();
+
+	explicit EventDispatcher(Target &target):
+		m_target(target),
+		m_numBindings(0),
+		m_dispatched(0)
+	{
+		for (UINT32 source = 0; source < EVENT_DISPATCHER_MAX_SOURCES; source++)
+		{
+			for (UINT32 edge = 0; edge < 2; edge++)
+			{
+				m_bound[source][edge] = 0;
+				for (UINT32 contact = 0; contact < EVENT_DISPATCHER_MAX_CONTACTS; contact++)
+				{
+					m_first[source][edge][contact] = kNoBinding;
+				}
+			}
+		}
+	}
+
+	// Returns false if the table is full or the arguments are out of range.
+	bool Bind(UINT32 source, UINT32 mask, EventType edge, Action action)
+	{
+		UINT32 contact = Contact(mask);
+		if (source >= EVENT_DISPATCHER_MAX_SOURCES || contact >= EVENT_DISPATCHER_MAX_CONTACTS ||
+			(kEventClosed != edge && kEventOpened != edge) ||
+			m_numBindings >= EVENT_DISPATCHER_MAX_BINDINGS)
+		{
+			return false;
+		}
+
+		UINT32 e = Edge(edge);
+		Binding &binding = m_bindings[m_numBindings];
+		binding.action = action;
+		binding.next = kNoBinding;
+
+		// Append, so actions run in the order they were bound
+		UINT8 *link = &m_first[source][e][contact];
+		while (kNoBinding != *link)
+		{
+			link = &m_bindings[*link].next;
+		}
+		*link = (UINT8)m_numBindings++;
+		m_bound[source][e] |= (UINT16)(1 << contact);
+		return true;
+	}
+
+	void Dispatch(UINT32 source, UINT32 closed, UINT32 opened)
+	{
+		Run(source, Edge(kEventClosed), closed & m_bound[source][Edge(kEventClosed)]);
+		Run(source, Edge(kEventOpened), opened & m_bound[source][Edge(kEventOpened)]);
+	}
+
+	// From an EEventCore (or anything with the same mask accessors)
+	template <class Events>
+	void Dispatch(UINT32 source, const Events &events)
+	{
+		Dispatch(source, events.GetClosedMask(), events.GetOpenedMask());
+	}
+
+	// Actions run since construction.
+	UINT32 GetDispatchCount() { return m_dispatched; }
+
+private:
+	static const UINT8 kNoBinding = 0xFF;
+
+	typedef struct
+	{
+		Action action;
+		UINT8 next;
+	} Binding;
+
+	static UINT32 Edge(EventType edge)
+	{
+		return kEventClosed == edge ? 0 : 1;
+	}
+
+	// Lowest set bit of the mask (EVENT_DISPATCHER_MAX_CONTACTS for none)
+	static UINT32 Contact(UINT32 mask)
+	{
+		UINT32 contact = 0;
+		while (contact < EVENT_DISPATCHER_MAX_CONTACTS && !(mask & (1u << contact)))
+		{
+			contact++;
+		}
+		return contact;
+	}
+
+	void Run(UINT32 source, UINT32 edge, UINT32 pending)
+	{
+		while (pending)
+		{
+			UINT32 contact = Contact(pending);
+			pending &= pending - 1;
+			for (UINT8 i = m_first[source][edge][contact]; kNoBinding != i; i = m_bindings[i].next)
+			{
+				(m_target.*m_bindings[i].action)();
+				m_dispatched++;
+			}
+		}
+	}
+
+	Target &m_target;
+	UINT16 m_bound[EVENT_DISPATCHER_MAX_SOURCES][2];
+	UINT8 m_first[EVENT_DISPATCHER_MAX_SOURCES][2][EVENT_DISPATCHER_MAX_CONTACTS];
+	Binding m_bindings[EVENT_DISPATCHER_MAX_BINDINGS];
+	UINT32 m_numBindings;
+	UINT32 m_dispatched;
+};
+
+#endif
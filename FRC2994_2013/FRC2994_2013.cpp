@@ -1,23 +1,74 @@
 #include "WPILib.h"
 #include "BasicDefines.h"
+#include "RobotProfiles.h"
 #include "EGamepad.h"
 #include "EAnalogTrigger.h"
 #include "EDigitalInput.h"
-#include "Ejoystick.h"
+#include "EJoystick.h"
+#include "PeriodicLoop.h"
+#include "LoopProfiler.h"
+#include "InputSnapshot.h"
+#include "InputLog.h"
+#include "MatchLog.h"
+#include "TelemetryTask.h"
+#include "DashboardPublisher.h"
+#include "LCDPublisher.h"
+#include "AnalogFilter.h"
+#include "DriveOdometry.h"
+#include "DriveController.h"
+#include "TrajectoryTable.h"
+#include "ParameterStore.h"
+#include "DriveSubsystem.h"
+#include "ArmSubsystem.h"
+#include "ShooterSubsystem.h"
+#include "PneumaticsSubsystem.h"
+#include "EventDispatcher.h"
+#include "RateScheduler.h"
+#include "AutonomousEngine.h"
 #include "NetworkTables/NetworkTable.h"
 #include "Timer.h"
+#include <stdio.h>
+#include <string.h>
 
 /**
  * This is Wham-O - the 2013 2994 Robot
+ * 
+ * The Profile (see RobotProfiles.h) supplies everything that differs between
+ * Plyboy, WhamO-1 and WhamO-2.
  */ 
 
+template <class Profile>
 class RobotDemo : public SimpleRobot
 {
+	// Teleop tasks, each timed by the profiler as a stage (see
+	// ScheduleTeleop)
+	typedef enum
+	{
+		kProfileSampleInputs, kProfileUpdateEvents, kProfileEvents,
+		kProfileDrive, kProfileShooter, kProfilePneumatics, kProfileArm,
+		kProfileStatusDisplays, kProfileSanityLCD
+	} ProfileStage;
+	
+	// Event words dispatched through the binding table (see BindEvents)
+	typedef enum
+	{
+		kSourceStick2, kSourceIndexerSwitch, kSourceDPad, kSourceGamepad
+	} EventSource;
+
+	// Values published to the SmartDashboard
+	typedef enum
+	{
+		kDashIndexSwitch, kDashShooterMotor, kDashIndexerMotor, kDashPotentiometer,
+		kDashGreenClawState, kDashYellowClawState, kDashShiftCount,
+		kDashShooterRPM, kDashShooterReady, kDashSwitchGlitches, kDashAirReserve,
+		kDashInputLogDropped
+	} DashboardKey;
+
 	// Drive motors
-	LEFT_DRIVE_MOTOR  leftFrontDriveMotor; // Done BEFORE the robot drive which uses them
-	LEFT_DRIVE_MOTOR  leftRearDriveMotor;
-	RIGHT_DRIVE_MOTOR rightFrontDriveMotor;
-	RIGHT_DRIVE_MOTOR rightRearDriveMotor;
+	typename Profile::DriveMotor leftFrontDriveMotor; // Done BEFORE the robot drive which uses them
+	typename Profile::DriveMotor leftRearDriveMotor;
+	typename Profile::DriveMotor rightFrontDriveMotor;
+	typename Profile::DriveMotor rightRearDriveMotor;
 	
 	// Drive system
 	RobotDrive myRobot; // robot drive system
@@ -27,38 +78,49 @@ class RobotDemo : public SimpleRobot
 	EJoystick stick2;
 	EGamepad  gamepad;
 	
-	// Other Motor Controllers (macros used because of differing hw on plyboy and bots)
-	INDEXER_MOTOR_CONTROLLER   indexerMotor;
-	SHOOTER_MOTOR_CONTROLLER   shooterMotor;
-	ARM_MOTOR_CONTROLLER       armMotor;
-	
-	// Shaft encoders
-	Encoder leftDriveEncoder;
-	Encoder rightDriveEncoder;
-	
-	// Output Devices
-	DoubleSolenoid shifter;
-	DoubleSolenoid greenClaw;
-	DoubleSolenoid yellowClaw;
+	// Other Motor Controllers (from the profile because of differing hw on plyboy and bots)
+	typename Profile::IndexerMotor indexerMotor;
+	typename Profile::ShooterMotor shooterMotor;
+	typename Profile::ArmMotor     armMotor;
 	
 	// Input sensors
-	AnalogChannel potentiometer;
 	EDigitalInput indexerSwitch;
-	EDigitalInput greenClawLockSwitch;
-	EDigitalInput yellowClawLockSwitch;
+	
+	// Subsystems, each with its own sensors and logic (see Subsystem)
+	DriveSubsystem drive;
+	ArmSubsystem arm;
+	ShooterSubsystem shooter;
+	PneumaticsSubsystem pneumatics;
 	
 	// Miscellaneous
-	Compressor compressor;
-	Timer jogTimer;
-	Timer shooterTimer;
+	PeriodicLoop autonomousLoop;
+	PeriodicLoop teleopLoop;
+	LoopProfiler profiler;
+	TelemetryTask telemetry;
+	DashboardPublisher dashboard;
+	LCDPublisher lcd;
+	AnalogFilter potFilter;
+	DriveOdometry odometry;
+	DriveController driveController;
+	TrajectoryTable autoTrajectory;
+	ParameterStore parameters;
+	AutonomousEngine autonomous;
+	InputLog inputLog;
+	MatchLog matchLog;
+	EventDispatcher<RobotDemo> bindings;
+	RateScheduler<RobotDemo> teleopTasks;
 
 	// Nonobject members
-	bool  m_shooterMotorRunning;
-	bool  m_jogTimerRunning;
-	int   m_shiftCount;
-	float m_previousPot;
+	bool  m_recording;
+	bool  m_replaying;
+	UINT32 m_indexerEdges;
+	UINT32 m_maxIndexerEdgeDelay;
 	
-	DriverStationLCD *dsLCD;
+	// All inputs for the current tick (see SampleInputs)
+	InputSnapshot m_inputs;
+	
+	// Tuning values for the current tick (see ApplyTuning)
+	const TuningParameters *m_tuning;
 
 public:
 	RobotDemo(void):
@@ -73,316 +135,467 @@ public:
 		indexerMotor(INDEX_PWM),
 		shooterMotor(SHOOTER_PWM),
 		armMotor (ARM_PWM),
-		leftDriveEncoder(LEFT_DRIVE_ENC_A, LEFT_DRIVE_ENC_B),
-		rightDriveEncoder(RIGHT_DRIVE_ENC_A, RIGHT_DRIVE_ENC_B),
-		shifter(SHIFTER_A,SHIFTER_B),
-		greenClaw(GREEN_CLAW_LOCKED, GREEN_CLAW_UNLOCKED),
-		yellowClaw(YELLOW_CLAW_LOCKED, YELLOW_CLAW_UNLOCKED),
-		potentiometer(ARM_ROTATION_POT),
 		indexerSwitch(INDEXER_SW),
-		greenClawLockSwitch(GREEN_LOCK_SENSOR),
-		yellowClawLockSwitch(YELLOW_LOCK_SENSOR),
-		compressor(COMPRESSOR_PRESSURE_SW, COMPRESSOR_SPIKE),
-		jogTimer(),
-		shooterTimer()
+		drive(myRobot, Profile::kReverseLeftEncoder, Profile::kReverseRightEncoder),
+		arm(armMotor),
+		shooter(shooterMotor, indexerMotor),
+		pneumatics(Profile::kHighGear, Profile::kLowGear, Profile::kClawSensorInverted),
+		autonomousLoop(AUTONOMOUS_LOOP_PERIOD),
+		teleopLoop(TELEOP_LOOP_PERIOD),
+		profiler(),
+		telemetry(TELEMETRY_PERIOD, TELEMETRY_TASK_PRIORITY),
+		dashboard(telemetry, DASHBOARD_FLUSH_PERIOD, DASHBOARD_BYTES_PER_SECOND),
+		lcd(telemetry, LCD_FLUSH_PERIOD),
+		potFilter(),
+		odometry(),
+		driveController(myRobot),
+		autoTrajectory(),
+		parameters(DefaultTuning()),
+		autonomous(myRobot, shooterMotor, indexerMotor, indexerSwitch, shooter.GetSpeed(),
+				driveController, odometry, parameters),
+		inputLog(),
+		matchLog(),
+		bindings(*this),
+		teleopTasks(*this, profiler, TELEOP_LOOP_PERIOD)
 	{
-		m_shooterMotorRunning = false;
-		m_jogTimerRunning     = false;
-		m_shiftCount          = MAX_SHIFTS;
-		
-		dsLCD = DriverStationLCD::GetInstance();
-		dsLCD->Clear();
-		dsLCD->PrintfLine(DriverStationLCD::kUser_Line1, "2013 " NAME);
-		dsLCD->PrintfLine(DriverStationLCD::kUser_Line2, __DATE__ " " __TIME__);
-		
-#ifdef WHAMO1
-		myRobot.SetInvertedMotor(RobotDrive::kRearLeftMotor, true); 
-		myRobot.SetInvertedMotor(RobotDrive::kFrontLeftMotor, true); 
-#endif
+		// Tuning from the file on the robot, where there is one
+		if (parameters.Load(TUNING_FILE))
+		{
+			printf("Tuning loaded from %s\n", TUNING_FILE);
+		}
+		m_tuning = &parameters.Get();
+		
+		arm.SetLimits(m_tuning->climbLimit, m_tuning->descendLimit);
+		ConfigureFilters();
+		ConfigureAir();
+		m_recording           = false;
+		m_replaying           = false;
+		m_indexerEdges        = 0;
+		m_maxIndexerEdgeDelay = 0;
+		
+		lcd.PrintfLine(DriverStationLCD::kUser_Line1, "2013 %s", Profile::Name());
+		lcd.PrintfLine(DriverStationLCD::kUser_Line2, __DATE__ " " __TIME__);
+		
+		if (Profile::kInvertLeftDrive)
+		{
+			myRobot.SetInvertedMotor(RobotDrive::kRearLeftMotor, true); 
+			myRobot.SetInvertedMotor(RobotDrive::kFrontLeftMotor, true); 
+		}
 		
-		dsLCD->UpdateLCD();
 		myRobot.SetExpiration(0.1);
-		shifter.Set(DoubleSolenoid::kReverse);
 		
-		leftDriveEncoder.SetDistancePerPulse(DRIVE_ENCODER_DISTANCE_PER_PULSE);
-		leftDriveEncoder.SetMaxPeriod(1.0);
-		leftDriveEncoder.SetReverseDirection(true);  // change to true if necessary
-		leftDriveEncoder.Start();
+		indexerSwitch.SetDebounce(INDEXER_SW_DEBOUNCE_SAMPLES, INDEXER_SW_DEBOUNCE_TIME);
+		
+		// The indexer stops from the switch's interrupt as the cam comes
+		// round, instead of running on until the next loop tick sees it. An
+		// opening shorter than the debounce is a glitch and the loop starts
+		// the indexer again (see EDigitalInput).
+		indexerSwitch.SetStopAction(&indexerMotor);
+		indexerSwitch.RequestEdges();
+		
+		BindEvents();
+		
+		profiler.SetStageName(kProfileSampleInputs, "SampleInputs");
+		profiler.SetStageName(kProfileUpdateEvents, "UpdateEvents");
+		profiler.SetStageName(kProfileEvents, "DispatchEvents");
+		profiler.SetStageName(kProfileStatusDisplays, "UpdateStatusDisplays");
+		profiler.SetStageName(kProfileSanityLCD, "sanity LCD");
+		ScheduleTeleop();
+		
+		dashboard.DefineBoolean(kDashIndexSwitch, "indexSwitch", 0.0);
+		dashboard.DefineNumber(kDashShooterMotor, "shooterMotor", 0.0, 0.0);
+		dashboard.DefineNumber(kDashIndexerMotor, "indexerMotor", 0.0, 0.0);
+		dashboard.DefineNumber(kDashPotentiometer, "Potentiometer", m_tuning->potEpsilon, POT_MIN_INTERVAL);
+		dashboard.DefineBoolean(kDashGreenClawState, "Green Claw State", 0.0);
+		dashboard.DefineBoolean(kDashYellowClawState, "Yellow Claw State", 0.0);
+		dashboard.DefineNumber(kDashShiftCount, "Shift Count", 0.0, 0.0);
+		dashboard.DefineNumber(kDashAirReserve, "Air Reserve", AIR_RESERVE_EPSILON, AIR_RESERVE_MIN_INTERVAL);
+		dashboard.DefineNumber(kDashShooterRPM, "Shooter RPM", SHOOTER_RPM_EPSILON, SHOOTER_RPM_MIN_INTERVAL);
+		dashboard.DefineBoolean(kDashShooterReady, "Shooter Ready", 0.0);
+		dashboard.DefineNumber(kDashSwitchGlitches, "Switch Glitches", 0.0, SWITCH_GLITCH_MIN_INTERVAL);
+		dashboard.DefineNumber(kDashInputLogDropped, "Input Log Dropped", 0.0, 0.0);
+		
+		// Dashboard and LCD output from the loops goes through this task
+		lcd.Flush(GetFPGATime());
+		telemetry.Start();
+		
+		// Work out the autonomous drive setpoints now, so the autonomous loop
+		// only has to look them up
+		if (!autoTrajectory.Generate(m_autoForward, NUM_AUTONOMOUS_STEPS, AUTONOMOUS_LOOP_PERIOD))
+		{
+			printf("Autonomous trajectory does not fit, driving open loop\n");
+		}
+		
+		// Teleop replays a recorded log instead of reading the inputs when
+		// one has been asked for (only ever on the host simulation)
+		if (NULL != InputLog::GetReplayFile())
+		{
+			if (!inputLog.Load(InputLog::GetReplayFile()))
+			{
+				printf("Cannot load input log %s\n", InputLog::GetReplayFile());
+			}
+		}
 	}
 	
-	double absolute(double value)
+	// Defaults for everything in the tuning file
+	static TuningParameters DefaultTuning(void)
 	{
-		if (value < 0.0)
-		{
-			value = -1.0 * value;
-		}
-		return value;
+		TuningParameters defaults;
+		defaults.shooterSpinupTime = SHOOTER_SPINUP_TIME;
+		defaults.reSpinupTime = RE_SPINUP_TIME;
+		defaults.climbLimit = Profile::ClimbLimit();
+		defaults.descendLimit = Profile::DescendLimit();
+		defaults.armJogStep = ARM_JOG_STEP;
+		defaults.shooterForward = SHOOTER_FWD;
+		defaults.indexerForward = INDEXER_FWD;
+		defaults.potEpsilon = POT_EPSILON;
+		defaults.potMedianTaps = POT_MEDIAN_TAPS;
+		defaults.potFilterTime = POT_FILTER_TIME;
+		defaults.airFillRate = AIR_FILL_RATE;
+		defaults.clawReserve = AIR_CLAW_RESERVE;
+		return defaults;
 	}
 	
-	// Robot movements in autonomous mode are table driven. Each entry of
-	// the tables is executed by this method.
-	void DoAutonomousMoveStep(const step_speed *speeds, char * message)
+	// Pick up a tuning file staged while disabled. Called between ticks, so a
+	// tick never sees half of one set and half of another.
+	void ApplyTuning(void)
 	{
-		// There are encoders on both sides of the drive system. We only use
-		// one for simplicity.
-		leftDriveEncoder.Reset();
-		double dist = speeds[0].distance;
-		double reading;
-		
-		// Start moving the robot
-		myRobot.Drive(speeds->magnitude, speeds->curve);
-
-		reading = absolute(leftDriveEncoder.GetDistance());
-		
-		// Just in case something goes wrong with the encoder (which could
-		// leave us in an infinite loop and prevent us from entering telop
-		// mode) we also exit the loop when no longer in autonomous mode.
-		while (IsAutonomous() && (dist > reading))
+		if (parameters.Apply())
 		{
-			Wait(0.02);
-			reading = absolute(leftDriveEncoder.GetDistance());
-			dsLCD->UpdateLCD();
+			m_tuning = &parameters.Get();
+			dashboard.SetDeadband(kDashPotentiometer, m_tuning->potEpsilon);
+			arm.SetLimits(m_tuning->climbLimit, m_tuning->descendLimit);
+			ConfigureFilters();
+			ConfigureAir();
 		}
-		
-		myRobot.Drive(0.0, 0.0);
 	}
-
-	// Shoot a single disk by cycling the indexer once and then
-	// pausing to let the shooter motor spin back up to full speed.
-	void DoAutonomousShootOneDisk()
+	
+	void ConfigureFilters(void)
 	{
-		// We need to do an update here in order to see any changes
-		// (autonomous mode is not a loop like teleop mode).
-		indexerSwitch.Update();
-
-		indexerMotor.Set(INDEXER_FWD);
-
-		// Wait for the indexer to cycle once (to prevent an unlikely but
-		// possible infinite loop that would prevent us from going into
-		// telop mode, we also exit the loop if autonomous mode ends)
-		while (IsAutonomous() && indexerSwitch.GetEvent() != kEventOpened)
-		{
-			Wait(0.02);
-			indexerSwitch.Update();
-		}
-
-		indexerMotor.Set(0.0);
-
-		// Let the shooter motor get back up to full speed
-		Wait(RE_SPINUP_TIME);	
+		potFilter.SetMedian(m_tuning->potMedianTaps);
+		potFilter.SetExponential(m_tuning->potFilterTime);
 	}
-
+	
+	void ConfigureAir(void)
+	{
+		pneumatics.SetFillRate(m_tuning->airFillRate);
+		pneumatics.SetClawReserve(m_tuning->clawReserve);
+	}
+	
+	// Re-read the tuning file every time the robot is disabled, so a change
+	// copied onto the robot at an event takes effect in the next mode
+	void Disabled(void)
+	{
+		parameters.Stage(TUNING_FILE);
+	}
+	
+	// Autonomous runs the shooter and (when enabled) the drive step table as
+	// state machines in AutonomousEngine, stepped at the loop rate, instead
+	// of blocking in Wait calls. Driving can then overlap with the shooter
+	// spinning up and firing.
 	void Autonomous(void)
 	{
 		myRobot.SetSafetyEnabled(false);
 
-		// Read twice to make sure there are no false events
-		// due to a comparison against a default initial value.
-		indexerSwitch.Update();
-		indexerSwitch.Update();
-
-		shooterMotor.Set(SHOOTER_FWD);
+		ApplyTuning();
+		
+		RestartInputs();
+		
+		// Take the switch's state as it is, so there is no false event
+		// from a comparison against a default initial value.
+		SampleInputs();
+		indexerSwitch.Prime(m_inputs.indexerSwitch);
+		
+		// Autonomous moves are measured from where the robot starts
+		odometry.Reset(m_inputs);
+		
+		// A match log starts with autonomous
+		matchLog.Clear();
 
-		// Wait for the shooter motor to spin up to speed
-		Wait(2.5);
+#ifdef AUTONOMOUS_DRIVE
+		autonomous.Start(m_inputs, m_autoForward, NUM_AUTONOMOUS_STEPS, &autoTrajectory);
+#else
+		// Move the robot to a position closer to our feeder station 
+		// (left out until we get a chance to actually try it)
+		autonomous.Start(m_inputs, NULL, 0, NULL);
+#endif
 
-		// Shoot the disks
-		for (int i = 0; i < NUM_AUTONOMOUS_DISKS; i++)
+		// The engine ticks until it is done; the loop keeps running to the
+		// end of the autonomous period so the inputs stay up to date.
+		bool done = false;
+		UINT32 started = m_inputs.timestamp;
+		UINT32 finished = started;
+		autonomousLoop.Start();
+		while (IsAutonomous() && IsEnabled())
 		{
-			DoAutonomousShootOneDisk();
+			ApplyTuning();
+			SampleInputs();
+			indexerSwitch.Update(m_inputs.indexerSwitch, m_inputs.timestamp);
+			shooter.Update(m_inputs);
+			if (!done)
+			{
+				done = autonomous.Tick(m_inputs);
+				finished = m_inputs.timestamp;
+			}
+			LogTick(kMatchLogAutonomous);
+			autonomousLoop.WaitForNextTick();
 		}
-		
-		shooterMotor.Set(0.0f);
 
-		// Move the robot to a position closer to our feeder station 
-		// (commented out until we get a chance to actually try it)
-//		DoAutonomousMoveStep(&m_autoForward[0], "Backing up...");
+		autonomous.Stop();
+		printf("Autonomous: %u disks shot, %s after %.2f s\n", autonomous.GetDisksShot(),
+				done ? "finished" : "cut short", (finished - started) / 1e6);
+		printf("Odometry: x %.1f in, y %.1f in, heading %.1f deg\n", odometry.GetX(),
+				odometry.GetY(), odometry.GetHeading() * 180.0 / 3.14159265);
 	}
 	
-	// Driver inputs are joystick one and a single button on joystick two
-	// which shifts the gearbox (press and hold)
-	void HandleDriverInputsManual(void)
+	// Read every input the loop uses once, at the top of the tick. Nothing
+	// below this should go back to the driver station or the sensors. In
+	// teleop the inputs are also recorded, or replayed from a loaded log.
+	void SampleInputs(void)
 	{
-		myRobot.ArcadeDrive(stick);
-		if(kEventOpened == stick2.GetEvent(BUTTON_SHIFT))
+		if (!m_replaying || !inputLog.Replay(GetFPGATime(), m_inputs))
 		{
-			if (m_shiftCount)
-			{
-				// Shift into high gear.
-				shifter.Set(
-				#ifdef WHAMO1
-								DoubleSolenoid::kForward);
-				#else
-								DoubleSolenoid::kReverse);
-				#endif
-				m_shiftCount--;
-			}
+			ReadInputs();
 		}
-		else if(kEventClosed == stick2.GetEvent(BUTTON_SHIFT))
+		if (m_recording)
 		{
-			if (m_shiftCount)
-			{
-				// Shift into low gear.
-				shifter.Set(
-				#ifdef WHAMO1
-								DoubleSolenoid::kReverse);
-				#else
-								DoubleSolenoid::kForward);
-				#endif
-				m_shiftCount--;
-			}
+			inputLog.Record(m_inputs);
 		}
+		ReadIndexerEdges();
+		
+		// Filtered values and estimates derived from the raw inputs. The
+		// raw values stay in the snapshot for the logs, and replay runs
+		// the filters again.
+		m_inputs.filteredPotentiometer = potFilter.Update(m_inputs.timestamp, m_inputs.potentiometer);
+		odometry.Update(m_inputs);
 	}
 	
-	// The arm inputs are:
-	// - the left gamepad joystick for continuous climb and descend, 
-	// - dpad up and down to climb and descend incrementaly
-	// - two buttons to lock the claws
-	// - two buttons to release the claws
-	void HandleArmInputs(void)
+	// The filters and the edge queue start again from the mode's first
+	// sample rather than from whatever they saw before the robot was
+	// disabled.
+	void RestartInputs(void)
 	{
-		if (!m_jogTimerRunning)
+		potFilter.Reset();
+		EDigitalEdge edge;
+		while (indexerSwitch.GetEdge(edge))
 		{
-			// Climb (fast)
-			if (gamepad.GetLeftY() < -0.1)
-			{
-				if (potentiometer.GetVoltage() > CLIMB_LIMIT)
-				{
-					armMotor.Set(gamepad.GetLeftY());
-				}
-				else
-				{
-					armMotor.Set(0.0);
-				}
-			}
-			// Descend (fast)
-			else if (gamepad.GetLeftY() > 0.1)
-			{
-				if (potentiometer.GetVoltage() < DESCEND_LIMIT)
-				{
-					armMotor.Set(gamepad.GetLeftY());
-				}
-				else
-				{
-					armMotor.Set(0.0);
-				}
-			}
-			// Climb ("jog")
-			else if (kEventClosed == gamepad.GetDPadEvent(Gamepad::kUp))
-			{
-				if (potentiometer.GetVoltage() > CLIMB_LIMIT)
-				{
-					armMotor.Set(ARM_CLIMB_JOG);
-					jogTimer.Start();
-					jogTimer.Reset();
-					m_jogTimerRunning = true;
-				}
-				else
-				{
-					armMotor.Set(0.0);
-				}
-			}
-			// Descend ("jog")
-			else if (kEventClosed == gamepad.GetDPadEvent(Gamepad::kDown))
-			{
-				if (potentiometer.GetVoltage() < DESCEND_LIMIT)
-				{
-					armMotor.Set(ARM_DESCEND_JOG);
-					jogTimer.Start();
-					jogTimer.Reset();
-					m_jogTimerRunning = true;
-				}
-				else
-				{
-					armMotor.Set(0.0);
-				}
-			}
-			else
-			{
-				armMotor.Set(0.0);
-			}
 		}
-		else if (jogTimer.HasPeriodPassed(JOG_TIME))
-		{
-			armMotor.Set(0);
-			jogTimer.Stop();
-			jogTimer.Reset();
-			m_jogTimerRunning = false;
-		}
-
-		if (gamepad.GetEvent(BUTTON_GREEN_CLAW_LOCKED) == kEventClosed)
-		{
-			// lock the green claw
-			greenClaw.Set(DoubleSolenoid::kForward);
-		}
-		else if (gamepad.GetEvent(BUTTON_GREEN_CLAW_UNLOCKED) == kEventClosed)
-		{
-			// unlock the green claw
-			greenClaw.Set(DoubleSolenoid::kReverse);
-		}
-		else if (gamepad.GetEvent(BUTTON_YELLOW_CLAW_LOCKED) == kEventClosed)
+		indexerSwitch.CancelResume();
+	}
+	
+	// Drain the indexer switch edges the interrupt handler queued. The loop
+	// only keeps count of them, and of how long before the tick they came,
+	// which is how late a polled stop would have been.
+	void ReadIndexerEdges(void)
+	{
+		EDigitalEdge edge;
+		while (indexerSwitch.GetEdge(edge))
 		{
-			// lock the yellow claw
-			yellowClaw.Set(DoubleSolenoid::kForward);
+			m_indexerEdges++;
+			UINT32 delay = m_inputs.timestamp - edge.timestamp;
+			if ((INT32)delay > (INT32)m_maxIndexerEdgeDelay)
+			{
+				m_maxIndexerEdgeDelay = delay;
+			}
 		}
-		else if (gamepad.GetEvent(BUTTON_YELLOW_CLAW_UNLOCKED) == kEventClosed)
+	}
+	
+	void ReadInputs(void)
+	{
+		m_inputs.timestamp = GetFPGATime();
+		
+		m_inputs.stickX = stick.GetX();
+		m_inputs.stickY = stick.GetY();
+		
+		m_inputs.stick2Buttons = stick2.GetButtonWord();
+		
+		m_inputs.gamepadLeftX = gamepad.GetLeftX();
+		m_inputs.gamepadLeftY = gamepad.GetLeftY();
+		m_inputs.gamepadRightX = gamepad.GetRightX();
+		m_inputs.gamepadRightY = gamepad.GetRightY();
+		m_inputs.gamepadButtons = gamepad.GetButtonWord();
+		m_inputs.gamepadDPad = gamepad.GetDPad();
+		
+		m_inputs.indexerSwitch = indexerSwitch.Get();
+		
+		drive.ReadInputs(m_inputs);
+		arm.ReadInputs(m_inputs);
+		shooter.ReadInputs(m_inputs);
+		pneumatics.ReadInputs(m_inputs);
+	}
+	
+	// Fill in this tick's match log record (see MatchLog), last thing in
+	// the tick so the loop time covers everything before it.
+	void LogTick(MatchLogMode mode)
+	{
+		MatchLogRecord *record = matchLog.Append();
+		if (NULL == record)
 		{
-			// unlock the yellow claw
-			yellowClaw.Set(DoubleSolenoid::kReverse);
+			return;
 		}
+		
+		record->timestamp = m_inputs.timestamp;
+		record->loopTime = GetFPGATime() - m_inputs.timestamp;
+		
+		record->stickX = m_inputs.stickX;
+		record->stickY = m_inputs.stickY;
+		record->gamepadLeftX = m_inputs.gamepadLeftX;
+		record->gamepadLeftY = m_inputs.gamepadLeftY;
+		record->gamepadRightX = m_inputs.gamepadRightX;
+		record->gamepadRightY = m_inputs.gamepadRightY;
+		record->potentiometer = m_inputs.potentiometer;
+		record->shooterRPM = (float)shooter.GetSpeed().GetRPM();
+		record->leftDriveCount = m_inputs.leftDriveCount;
+		record->rightDriveCount = m_inputs.rightDriveCount;
+		
+		record->leftDrive = leftFrontDriveMotor.Get();
+		record->rightDrive = rightFrontDriveMotor.Get();
+		record->shooter = shooterMotor.Get();
+		record->indexer = indexerMotor.Get();
+		record->arm = armMotor.Get();
+		
+		record->stick2Buttons = m_inputs.stick2Buttons;
+		record->gamepadButtons = m_inputs.gamepadButtons;
+		record->shiftCount = (INT16)pneumatics.GetShiftsLeft();
+		record->spare = 0;
+		record->gamepadDPad = (UINT8)m_inputs.gamepadDPad;
+		record->switches = (UINT8)((m_inputs.indexerSwitch ? MATCH_LOG_INDEXER_SWITCH : 0) |
+				(m_inputs.greenClawLockSwitch ? MATCH_LOG_GREEN_CLAW_SWITCH : 0) |
+				(m_inputs.yellowClawLockSwitch ? MATCH_LOG_YELLOW_CLAW_SWITCH : 0) |
+				(m_inputs.pressureSwitch ? MATCH_LOG_PRESSURE_SWITCH : 0));
+		record->solenoids = (UINT8)((pneumatics.GetShifter() << MATCH_LOG_SHIFTER_SHIFT) |
+				(pneumatics.GetClaw(kClawGreen) << MATCH_LOG_GREEN_CLAW_SHIFT) |
+				(pneumatics.GetClaw(kClawYellow) << MATCH_LOG_YELLOW_CLAW_SHIFT));
+		record->mode = (UINT8)mode;
+	}
+	
+	// The teleop work, by rate. The loop ticks at TELEOP_LOOP_PERIOD; the
+	// inputs, the events (the indexer stop among them), the drive, shooter
+	// and pneumatics run every tick, the arm servo every other one and the
+	// displays far less often. Tasks are added in priority order, heaviest
+	// of the slow ones first, so the scheduler keeps the slow tasks off each
+	// other's ticks. Each subsystem is its own profiler stage.
+	void ScheduleTeleop(void)
+	{
+		teleopTasks.AddTask(kProfileSampleInputs, &RobotDemo::SampleInputs, TELEOP_LOOP_PERIOD, 0);
+		teleopTasks.AddTask(kProfileUpdateEvents, &RobotDemo::UpdateEvents, TELEOP_LOOP_PERIOD, 1);
+		teleopTasks.AddTask(kProfileEvents, &RobotDemo::DispatchEvents, TELEOP_LOOP_PERIOD, 2);
+		teleopTasks.AddSubsystem(kProfileDrive, drive, DRIVE_TASK_PERIOD, 3);
+		teleopTasks.AddSubsystem(kProfileShooter, shooter, SHOOTER_TASK_PERIOD, 4);
+		teleopTasks.AddSubsystem(kProfilePneumatics, pneumatics, PNEUMATICS_TASK_PERIOD, 5);
+		teleopTasks.AddSubsystem(kProfileArm, arm, ARM_TASK_PERIOD, 6);
+		teleopTasks.AddTask(kProfileStatusDisplays, &RobotDemo::UpdateStatusDisplays, DASHBOARD_TASK_PERIOD, 7);
+		teleopTasks.AddTask(kProfileSanityLCD, &RobotDemo::UpdateLCD, LCD_TASK_PERIOD, 8);
 	}
 	
+	// Bring the event wrappers up to date with this tick's sample
+	void UpdateEvents(void)
+	{
+		gamepad.Update(m_inputs.gamepadButtons, m_inputs.gamepadDPad);
+		stick2.Update(m_inputs.stick2Buttons);
+		indexerSwitch.Update(m_inputs.indexerSwitch, m_inputs.timestamp);
+	}
+	
+	// Every button and switch action, bound once to the edge that fires it.
+	// The sources are dispatched in the order below, and within a source
+	// lowest contact first: the indexer switch stops the indexer before a
+	// press of the indexer button can restart it, and the stop-all button
+	// (10) comes after the shooter and indexer buttons.
+	void BindEvents(void)
+	{
+		// Shifter: press and hold joystick two's button for low gear
+		bindings.Bind(kSourceStick2, EJoystick::ButtonMask(BUTTON_SHIFT), kEventOpened, &RobotDemo::ShiftHigh);
+		bindings.Bind(kSourceStick2, EJoystick::ButtonMask(BUTTON_SHIFT), kEventClosed, &RobotDemo::ShiftLow);
+		
+		// Indexer cycle complete
+		bindings.Bind(kSourceIndexerSwitch, EEVENT_SINGLE_INPUT, kEventOpened, &RobotDemo::StopIndexer);
+		
+		// Arm steps and named positions
+		bindings.Bind(kSourceDPad, EGamepad::DPadMask(Gamepad::kUp), kEventClosed, &RobotDemo::JogArmUp);
+		bindings.Bind(kSourceDPad, EGamepad::DPadMask(Gamepad::kDown), kEventClosed, &RobotDemo::JogArmDown);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_ARM_REACH), kEventClosed, &RobotDemo::ArmToReach);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_ARM_CLIMB), kEventClosed, &RobotDemo::ArmToClimb);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_ARM_CENTER), kEventClosed, &RobotDemo::ArmToCenter);
+		
+		// Claw locks
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_GREEN_CLAW_LOCKED), kEventClosed, &RobotDemo::LockGreenClaw);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_GREEN_CLAW_UNLOCKED), kEventClosed, &RobotDemo::UnlockGreenClaw);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_YELLOW_CLAW_LOCKED), kEventClosed, &RobotDemo::LockYellowClaw);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_YELLOW_CLAW_UNLOCKED), kEventClosed, &RobotDemo::UnlockYellowClaw);
+		
+		// Shooter and indexer
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_TOGGLE_SHOOTER), kEventClosed, &RobotDemo::ToggleShooter);
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_INDEXER), kEventClosed, &RobotDemo::StartIndexer);
+		
+		// The reset button is intended to put the robot into a known
+		// (and safe) state. It should not be required outside of debugging
+		// new code but, as previous competitions have shown, you never know
+		// when you might need it do to sensor switch failure, etc.)
+		bindings.Bind(kSourceGamepad, EGamepad::ButtonMask(BUTTON_STOP_ALL), kEventClosed, &RobotDemo::StopAll);
+	}
+	
+	// Run the actions for this tick's edges, after the E* Updates
+	void DispatchEvents(void)
+	{
+		bindings.Dispatch(kSourceStick2, stick2.GetButtonEvents());
+		bindings.Dispatch(kSourceIndexerSwitch, indexerSwitch.GetEvents());
+		bindings.Dispatch(kSourceDPad, gamepad.GetDPadEvents());
+		bindings.Dispatch(kSourceGamepad, gamepad.GetButtonEvents());
+	}
+	
+	// Driver inputs are joystick one (see DriveSubsystem) and a single
+	// button on joystick two which shifts the gearbox (press and hold)
+	void ShiftHigh(void) { pneumatics.ShiftHigh(); }
+	void ShiftLow(void) { pneumatics.ShiftLow(); }
+	
+	// The arm inputs are:
+	// - the left gamepad joystick for continuous climb and descend (read
+	//   by ArmSubsystem)
+	// - dpad up and down to climb and descend by a fixed step
+	// - three buttons to send the arm to its named positions
+	// - two buttons to lock the claws
+	// - two buttons to release the claws
+	// The buttons are bound in BindEvents. ArmController closes the loop on
+	// the pot and slows the arm down before it reaches either limit.
+	
+	// Climb and descend ("jog")
+	void JogArmUp(void) { arm.Jog(-m_tuning->armJogStep); }
+	void JogArmDown(void) { arm.Jog(m_tuning->armJogStep); }
+	
+	void ArmToReach(void) { arm.SetSetpoint(kArmSetpointReach); }
+	void ArmToClimb(void) { arm.SetSetpoint(kArmSetpointClimb); }
+	void ArmToCenter(void) { arm.SetSetpoint(kArmSetpointCenter); }
+	
+	void LockGreenClaw(void) { pneumatics.LockClaw(kClawGreen); }
+	void UnlockGreenClaw(void) { pneumatics.UnlockClaw(kClawGreen); }
+	void LockYellowClaw(void) { pneumatics.LockClaw(kClawYellow); }
+	void UnlockYellowClaw(void) { pneumatics.UnlockClaw(kClawYellow); }
+	
 	// The shooter controls are:
 	// - a gamepad button to start/stop the shooter motor
 	// - a gamepad button to start the indexer (the indexer stops
 	//   when the indexer switch opens (it is normally closed) when
 	//   the an index cycle is complete)
-	void HandleShooterInputs()
+	void ToggleShooter(void) { shooter.ToggleShooter(m_tuning->shooterForward); }
+	void StartIndexer(void) { shooter.StartIndexer(m_tuning->indexerForward); }
+	// Deliberate stops, so the indexer switch must not put the indexer back
+	void StopIndexer(void)
 	{
-		if (indexerSwitch.GetEvent() == kEventOpened)
-		{
-			indexerMotor.Set(0.0);
-		}
-		
-		if (kEventClosed == gamepad.GetEvent(BUTTON_TOGGLE_SHOOTER))
-		{
-			if (!m_shooterMotorRunning)
-			{
-				m_shooterMotorRunning = true;
-				shooterMotor.Set(SHOOTER_FWD);
-			}
-			else
-			{
-				m_shooterMotorRunning = false;
-				shooterMotor.Set(0.0);
-			}
-		}
-		
-		if (kEventClosed == gamepad.GetEvent(BUTTON_INDEXER))
-		{
-			indexerMotor.Set(INDEXER_FWD);
-		}
+		indexerSwitch.CancelResume();
+		shooter.StopIndexer();
 	}
 	
-	// The reset button is intended to put the robot into a known
-	// (and safe) state. It should not be required outside of debugging
-	// new code but, as previous competitions have shown, you never know
-	// when you might need it do to sensor switch failure, etc.)
-	void HandleResetButton(void)
+	void StopAll(void)
 	{
-		if (gamepad.GetEvent(BUTTON_STOP_ALL) == kEventClosed)
-		{
-			shooterMotor.Set(0.0);
-			m_shooterMotorRunning  = false;
+		indexerSwitch.CancelResume();
+		shooter.Stop();
+		arm.Stop();
+	}
 
-			indexerMotor.Set(0.0);
-			
-			armMotor.Set(0.0);
-			
-			jogTimer.Stop();
-			jogTimer.Reset();
-			m_jogTimerRunning = false;
-		}
+	UINT32 SwitchGlitches(void)
+	{
+		return indexerSwitch.GetGlitchCount() + pneumatics.GetClawGlitchCount(kClawGreen) +
+			pneumatics.GetClawGlitchCount(kClawYellow);
 	}
 
 	void UpdateStatusDisplays(void)
@@ -396,39 +609,63 @@ public:
 //		SmartDashboard::PutNumber("stickY", stick.GetY());
 //		SmartDashboard::PutBoolean("shift", stick2.GetState(BUTTON_SHIFT) ? kStateClosed : kStateOpen);
 		
+		// Everything below goes through the dashboard publisher, which only sends
+		// values that have changed (beyond a dead-band for the pot), batches them
+		// into one flush every DASHBOARD_FLUSH_PERIOD and holds the total under
+		// DASHBOARD_BYTES_PER_SECOND.
+		
 		// Shooter/Indexer values
-		SmartDashboard::PutBoolean("indexSwitch", indexerSwitch.GetState() ? kStateClosed : kStateOpen);
-		SmartDashboard::PutNumber("shooterMotor", shooterMotor.Get());
-		SmartDashboard::PutNumber("indexerMotor", indexerMotor.Get());
+		dashboard.SetBoolean(kDashIndexSwitch, indexerSwitch.GetState() ? kStateClosed : kStateOpen);
+		dashboard.SetNumber(kDashShooterMotor, shooterMotor.Get());
+		dashboard.SetNumber(kDashIndexerMotor, indexerMotor.Get());
+		dashboard.SetNumber(kDashShooterRPM, shooter.GetSpeed().GetRPM());
+		dashboard.SetBoolean(kDashShooterReady, shooter.GetSpeed().IsReadyToFire());
 
 		// Misc Motor Values (as with the joystick values above, commented out to reduce network
 		// traffic to the dashboard)
 		
 //		SmartDashboard::PutNumber("armMotor", armMotor.Get());
 
-		// Arm position via potentiometer voltage (2.5 volts is center position)
-		float potVal = potentiometer.GetVoltage();
-		
-		// Checks if there has been a significant enough change in the value of
-		// the arm potentiometer to warrant sending the data to the dashboard.
-		if (absolute((m_previousPot - potVal)) > POT_EPSILON)
-		{
-			SmartDashboard::PutNumber("Potentiometer", potentiometer.GetVoltage());
-			m_previousPot = potVal;
-		}
+		// Arm position via potentiometer voltage (2.5 volts is center position).
+		// Only sent when it moves by more than the potEpsilon tuning value.
+		dashboard.SetNumber(kDashPotentiometer, m_inputs.filteredPotentiometer);
 		
 		// Claw lock states
-		SmartDashboard::PutBoolean("Green Claw State", GREEN_CLAW_LOCK_STATE);
-		SmartDashboard::PutBoolean("Yellow Claw State", YELLOW_CLAW_LOCK_STATE);
+		dashboard.SetBoolean(kDashGreenClawState, pneumatics.IsClawLocked(kClawGreen));
+		dashboard.SetBoolean(kDashYellowClawState, pneumatics.IsClawLocked(kClawYellow));
+		
+		// Shifts the air budget allows before it would eat into the claw
+		// lock reserve, and the reserve itself (psi)
+		dashboard.SetNumber(kDashShiftCount, pneumatics.GetShiftsLeft());
+		dashboard.SetNumber(kDashAirReserve, pneumatics.GetAirReserve());
+		
+		// Changes the switch debounce threw away; a count that keeps
+		// climbing points at a loose switch or wire
+		dashboard.SetNumber(kDashSwitchGlitches, SwitchGlitches());
+		
+		// Teleop ticks the input log had no room for; anything but zero
+		// means the replay of this match will stop short
+		dashboard.SetNumber(kDashInputLogDropped, inputLog.GetDroppedCount());
 		
-		// Pneumatic shifter count
-		SmartDashboard::PutNumber("Shift Count", m_shiftCount);
+		dashboard.Flush(m_inputs.timestamp);
 		
 		// State viariables. This is basically debug and is commented out, once again to reduce
 		// network traffic.
-//		dsLCD->PrintfLine(DriverStationLCD::kUser_Line6, "SMR: %s JTR: %s",
-//			m_shooterMotorRunning ? "T" : "F",   
-//			m_jogTimerRunning ? "T" : "F");
+//		lcd.PrintfLine(DriverStationLCD::kUser_Line6, "SMR: %s AH: %s",
+//			shooter.IsShooterRunning() ? "T" : "F",   
+//			arm.IsHolding() ? "T" : "F");
+	}
+	
+	// Sanity counter (the teleop tick count) so the drive team can see the
+	// loop is alive
+	void UpdateLCD(void)
+	{
+		// No longer needed as this information is output to the drive station
+		// via the SmartDashboard
+//		lcd.PrintfLine(DriverStationLCD::kUser_Line4, "G: %s", (pneumatics.IsClawLocked(kClawGreen) ? "Locked" : "Unlocked"));
+//		lcd.PrintfLine(DriverStationLCD::kUser_Line5, "Y: %s", (pneumatics.IsClawLocked(kClawYellow) ? "Locked" : "Unlocked"));
+		lcd.SetNumber(DriverStationLCD::kUser_Line3, "%d", (INT32)teleopTasks.GetTickCount());
+		lcd.Flush(m_inputs.timestamp);
 	}
 	
 	void OperatorControl(void)
@@ -446,57 +683,93 @@ public:
 		gamepad.EnableButton(BUTTON_STOP_ALL);
 		gamepad.EnableButton(BUTTON_JOG_FWD);
 		gamepad.EnableButton(BUTTON_JOG_REV);
+		gamepad.EnableButton(BUTTON_ARM_REACH);
+		gamepad.EnableButton(BUTTON_ARM_CLIMB);
+		gamepad.EnableButton(BUTTON_ARM_CENTER);
 		gamepad.EnableButton(BUTTON_TOGGLE_SHOOTER);
 		gamepad.EnableButton(BUTTON_INDEXER);
 
 		stick2.EnableButton(BUTTON_SHIFT);
 
+		// Send every dashboard value afresh when teleop starts
+		dashboard.Invalidate();
+		
+		// Record this teleop period, unless it is a replay of an earlier one
+		m_replaying = inputLog.GetTickCount() > 0 && NULL != InputLog::GetReplayFile();
+		m_recording = !m_replaying;
+		if (m_replaying)
+		{
+			inputLog.Rewind();
+		}
+		else
+		{
+			inputLog.StartRecording();
+		}
+		
+		ApplyTuning();
+		
 		// Set inital states for all switches and buttons
-		gamepad.Update();
-		indexerSwitch.Update();
-		greenClawLockSwitch.Update();
-		yellowClawLockSwitch.Update();
-		stick2.Update();
-		
-		// Set initial states for all pneumatic actuators
-		shifter.Set(
-#ifdef WHAMO1
-				DoubleSolenoid::kForward);
-#else
-				DoubleSolenoid::kReverse);
-#endif
+		RestartInputs();
+		SampleInputs();
+		UpdateEvents();
 		
-		greenClaw.Set(DoubleSolenoid::kReverse);
-		yellowClaw.Set(DoubleSolenoid::kReverse);
-
-		compressor.Start ();
+		drive.Start(m_inputs);
+		arm.Start(m_inputs);
+		shooter.Start(m_inputs);
+		pneumatics.Start(m_inputs);
 		
+		profiler.Reset();
+		teleopTasks.Reset();
+		teleopLoop.Start();
 		while (IsOperatorControl())
 		{
-			static int sanity = 0;
-			gamepad.Update();
-			stick2.Update();
-			indexerSwitch.Update();
-			greenClawLockSwitch.Update();
-			yellowClawLockSwitch.Update();
-			
-			HandleDriverInputsManual();
-			HandleArmInputs();
-			HandleShooterInputs();
-			HandleResetButton();
-			UpdateStatusDisplays();
+			profiler.BeginTick();
+			ApplyTuning();
+			teleopTasks.Run(m_inputs);
+			profiler.EndTick();
+			LogTick(kMatchLogTeleop);
 			
-			// No longer needed as this information is output to the drive station
-			// via the SmartDashboard
-//			dsLCD->PrintfLine(DriverStationLCD::kUser_Line4, "G: %s", (GREEN_CLAW_LOCK_STATE ? "Locked" : "Unlocked"));
-//			dsLCD->PrintfLine(DriverStationLCD::kUser_Line5, "Y: %s", (YELLOW_CLAW_LOCK_STATE ? "Locked" : "Unlocked"));
-//			
-//			dsLCD->UpdateLCD();
-			Wait(0.005);				// wait for a motor update time
-			sanity++;
-			
-			dsLCD->PrintfLine(DriverStationLCD::kUser_Line3, "%d", sanity);
+			teleopLoop.WaitForNextTick();	// wait for the next motor update time
 		}
+		
+		// Write the recording out now the loop is no longer running
+		if (m_recording)
+		{
+			m_recording = false;
+			printf("Input log: %u ticks, %u bytes, %u dropped, %s %s\n",
+					inputLog.GetTickCount(), inputLog.GetSize(), inputLog.GetDroppedCount(),
+					inputLog.Save(INPUT_LOG_FILE) ? "saved to" : "could not save to",
+					INPUT_LOG_FILE);
+		}
+		m_replaying = false;
+		
+		// The match log covers autonomous (if there was one) and teleop; the
+		// next teleop on its own starts a new one
+		printf("Match log: %u records, %u dropped, %s %s\n",
+				matchLog.GetCount(), matchLog.GetDroppedCount(),
+				matchLog.Save(MATCH_LOG_FILE) ? "saved to" : "could not save to",
+				MATCH_LOG_FILE);
+		matchLog.Clear();
+		
+		// Loop timing summary for the console (NetConsole on the robot)
+		printf("Teleop loop: %u ticks, %u overruns, %u skipped, jitter mean %u us max %u us\n",
+				teleopLoop.GetTickCount(), teleopLoop.GetOverrunCount(),
+				teleopLoop.GetSkippedTicks(), teleopLoop.GetMeanJitter(),
+				teleopLoop.GetMaxJitter());
+		profiler.Dump();
+		printf("Dashboard: %u puts, %u bytes, %u coalesced, %u deferred\n",
+				dashboard.GetPutCount(), dashboard.GetBytesSent(),
+				dashboard.GetCoalescedCount(), dashboard.GetDeferredCount());
+		printf("Indexer edges: %u, %u dropped, up to %u us before the loop, stopped within %u us\n",
+				m_indexerEdges, indexerSwitch.GetDroppedEdgeCount(), m_maxIndexerEdgeDelay,
+				indexerSwitch.GetMaxStopLatency());
+		printf("Events: %u actions dispatched\n", bindings.GetDispatchCount());
+		printf("Switch glitches: indexer %u, green claw %u, yellow claw %u\n",
+				indexerSwitch.GetGlitchCount(), pneumatics.GetClawGlitchCount(kClawGreen),
+				pneumatics.GetClawGlitchCount(kClawYellow));
+		printf("Telemetry: %u records sent, %u dropped\n",
+				telemetry.GetSentCount(), telemetry.GetDroppedCount());
+		printf("LCD: %u formats, %u updates\n", lcd.GetFormatCount(), lcd.GetUpdateCount());
 	}
 	
 	/**
@@ -504,8 +777,27 @@ public:
 	 */
 	void Test() 
 	{
+		// Dump the stage timings from the last teleop run on demand
+		profiler.Dump();
 	}
 };
 
-START_ROBOT_CLASS(RobotDemo);
+RobotBase *CreateRobot(const char *profileName)
+{
+	if (0 == strcmp(profileName, PlyboyProfile::Name()))
+	{
+		return new RobotDemo<PlyboyProfile>();
+	}
+	if (0 == strcmp(profileName, WhamO1Profile::Name()))
+	{
+		return new RobotDemo<WhamO1Profile>();
+	}
+	if (0 == strcmp(profileName, WhamO2Profile::Name()))
+	{
+		return new RobotDemo<WhamO2Profile>();
+	}
+	return NULL;
+}
+
+START_ROBOT_CLASS(RobotDemo<ROBOT_PROFILE>);
 
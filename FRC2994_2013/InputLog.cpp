@@ -0,0 +1,392 @@
+#include "InputLog.h"
+#include "BasicDefines.h"
+#include <stdio.h>
+#include <string.h>
+
+// Bits of the per-tick mask, one for each field that can change
+enum
+{
+	kFieldStickX = 1 << 0,
+	kFieldStickY = 1 << 1,
+	kFieldStick2Buttons = 1 << 2,
+	kFieldGamepadLeftX = 1 << 3,
+	kFieldGamepadLeftY = 1 << 4,
+	kFieldGamepadRightX = 1 << 5,
+	kFieldGamepadRightY = 1 << 6,
+	kFieldGamepadButtons = 1 << 7,
+	kFieldGamepadDPad = 1 << 8,
+	kFieldSwitches = 1 << 9,
+	kFieldLeftDriveCount = 1 << 10,
+	kFieldRightDriveCount = 1 << 11,
+	kFieldLeftDriveRate = 1 << 12,
+	kFieldRightDriveRate = 1 << 13,
+	kFieldPotentiometer = 1 << 14,
+	kFieldShooterPeriod = 1 << 15,
+	kFieldAll = (1 << 16) - 1
+};
+
+// The four digital inputs share one byte
+enum
+{
+	kSwitchIndexer = 1 << 0,
+	kSwitchGreenClawLock = 1 << 1,
+	kSwitchYellowClawLock = 1 << 2,
+	kSwitchPressure = 1 << 3
+};
+
+// File header: magic, version, then the tick count, duration (us), data
+// size and dropped tick count, each four bytes.
+#define INPUT_LOG_MAGIC "WHIL"
+#define INPUT_LOG_VERSION 2
+#define INPUT_LOG_HEADER_SIZE 21
+
+const char *InputLog::s_replayFile = NULL;
+
+// Floats are compared and stored by their bit pattern, so an infinite
+// shooter period survives the trip.
+static UINT32 FloatBits(float value)
+{
+	UINT32 bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+static bool FloatChanged(float value, float previous)
+{
+	return FloatBits(value) != FloatBits(previous);
+}
+
+static UINT32 Switches(const InputSnapshot &inputs)
+{
+	UINT32 switches = 0;
+	if (inputs.indexerSwitch)        switches |= kSwitchIndexer;
+	if (inputs.greenClawLockSwitch)  switches |= kSwitchGreenClawLock;
+	if (inputs.yellowClawLockSwitch) switches |= kSwitchYellowClawLock;
+	if (inputs.pressureSwitch)       switches |= kSwitchPressure;
+	return switches;
+}
+
+// Signed changes are folded so small ones of either sign stay small.
+static UINT32 ZigZag(INT32 value)
+{
+	return ((UINT32)value << 1) ^ (UINT32)(value >> 31);
+}
+
+static INT32 UnZigZag(UINT32 value)
+{
+	return (INT32)(value >> 1) ^ -(INT32)(value & 1);
+}
+
+static void PutWord(UINT8 *bytes, UINT32 value)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		bytes[i] = (UINT8)(value >> (8 * i));
+	}
+}
+
+static UINT32 GetWord(const UINT8 *bytes)
+{
+	UINT32 value = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		value |= (UINT32)bytes[i] << (8 * i);
+	}
+	return value;
+}
+
+InputLog::InputLog()
+{
+	StartRecording();
+}
+
+InputLog::~InputLog()
+{
+}
+
+void InputLog::StartRecording()
+{
+	memset(&m_previous, 0, sizeof(m_previous));
+	m_size = 0;
+	m_position = 0;
+	m_ticks = 0;
+	m_replayed = 0;
+	m_dropped = 0;
+	m_duration = 0;
+	m_offset = 0;
+}
+
+void InputLog::Record(const InputSnapshot &inputs)
+{
+	if (m_size + INPUT_LOG_MAX_TICK > INPUT_LOG_BUFFER_SIZE)
+	{
+		if (0 == m_dropped)
+		{
+			printf("Input log full after %u ticks, dropping the rest\n", m_ticks);
+		}
+		m_dropped++;
+		return;
+	}
+
+	// The first tick is stored whole so a replay needs nothing before it.
+	UINT32 mask = kFieldAll;
+	if (m_ticks > 0)
+	{
+		const InputSnapshot &p = m_previous;
+		mask = 0;
+		if (FloatChanged(inputs.stickX, p.stickX))               mask |= kFieldStickX;
+		if (FloatChanged(inputs.stickY, p.stickY))               mask |= kFieldStickY;
+		if (inputs.stick2Buttons != p.stick2Buttons)             mask |= kFieldStick2Buttons;
+		if (FloatChanged(inputs.gamepadLeftX, p.gamepadLeftX))   mask |= kFieldGamepadLeftX;
+		if (FloatChanged(inputs.gamepadLeftY, p.gamepadLeftY))   mask |= kFieldGamepadLeftY;
+		if (FloatChanged(inputs.gamepadRightX, p.gamepadRightX)) mask |= kFieldGamepadRightX;
+		if (FloatChanged(inputs.gamepadRightY, p.gamepadRightY)) mask |= kFieldGamepadRightY;
+		if (inputs.gamepadButtons != p.gamepadButtons)           mask |= kFieldGamepadButtons;
+		if (inputs.gamepadDPad != p.gamepadDPad)                 mask |= kFieldGamepadDPad;
+		if (Switches(inputs) != Switches(p))                     mask |= kFieldSwitches;
+		if (inputs.leftDriveCount != p.leftDriveCount)           mask |= kFieldLeftDriveCount;
+		if (inputs.rightDriveCount != p.rightDriveCount)         mask |= kFieldRightDriveCount;
+		if (FloatChanged((float)inputs.leftDriveRate, (float)p.leftDriveRate))
+		{
+			mask |= kFieldLeftDriveRate;
+		}
+		if (FloatChanged((float)inputs.rightDriveRate, (float)p.rightDriveRate))
+		{
+			mask |= kFieldRightDriveRate;
+		}
+		if (FloatChanged(inputs.potentiometer, p.potentiometer)) mask |= kFieldPotentiometer;
+		if (FloatChanged((float)inputs.shooterPeriod, (float)p.shooterPeriod))
+		{
+			mask |= kFieldShooterPeriod;
+		}
+		m_duration += inputs.timestamp - p.timestamp;
+	}
+
+	PutVarint(mask);
+	PutVarint(inputs.timestamp - m_previous.timestamp);
+	if (mask & kFieldStickX)          PutFloat(inputs.stickX);
+	if (mask & kFieldStickY)          PutFloat(inputs.stickY);
+	if (mask & kFieldStick2Buttons)   PutVarint(inputs.stick2Buttons);
+	if (mask & kFieldGamepadLeftX)    PutFloat(inputs.gamepadLeftX);
+	if (mask & kFieldGamepadLeftY)    PutFloat(inputs.gamepadLeftY);
+	if (mask & kFieldGamepadRightX)   PutFloat(inputs.gamepadRightX);
+	if (mask & kFieldGamepadRightY)   PutFloat(inputs.gamepadRightY);
+	if (mask & kFieldGamepadButtons)  PutVarint(inputs.gamepadButtons);
+	if (mask & kFieldGamepadDPad)     PutVarint(inputs.gamepadDPad);
+	if (mask & kFieldSwitches)        PutByte(Switches(inputs));
+	if (mask & kFieldLeftDriveCount)
+	{
+		PutVarint(ZigZag(inputs.leftDriveCount - m_previous.leftDriveCount));
+	}
+	if (mask & kFieldRightDriveCount)
+	{
+		PutVarint(ZigZag(inputs.rightDriveCount - m_previous.rightDriveCount));
+	}
+	if (mask & kFieldLeftDriveRate)   PutFloat((float)inputs.leftDriveRate);
+	if (mask & kFieldRightDriveRate)  PutFloat((float)inputs.rightDriveRate);
+	if (mask & kFieldPotentiometer)   PutFloat(inputs.potentiometer);
+	if (mask & kFieldShooterPeriod)   PutFloat((float)inputs.shooterPeriod);
+
+	m_previous = inputs;
+	m_ticks++;
+}
+
+bool InputLog::Save(const char *path)
+{
+	FILE *file = fopen(path, "wb");
+	if (NULL == file)
+	{
+		return false;
+	}
+
+	UINT8 header[INPUT_LOG_HEADER_SIZE];
+	memcpy(header, INPUT_LOG_MAGIC, 4);
+	header[4] = INPUT_LOG_VERSION;
+	PutWord(&header[5], m_ticks);
+	PutWord(&header[9], m_duration);
+	PutWord(&header[13], m_size);
+	PutWord(&header[17], m_dropped);
+
+	bool ok = (1 == fwrite(header, sizeof(header), 1, file)) &&
+		(0 == m_size || 1 == fwrite(m_buffer, m_size, 1, file));
+	if (0 != fclose(file))
+	{
+		ok = false;
+	}
+	return ok;
+}
+
+bool InputLog::Load(const char *path)
+{
+	StartRecording();
+
+	FILE *file = fopen(path, "rb");
+	if (NULL == file)
+	{
+		return false;
+	}
+
+	UINT8 header[INPUT_LOG_HEADER_SIZE];
+	bool ok = (1 == fread(header, sizeof(header), 1, file)) &&
+		0 == memcmp(header, INPUT_LOG_MAGIC, 4) &&
+		INPUT_LOG_VERSION == header[4];
+	UINT32 size = ok ? GetWord(&header[13]) : 0;
+	if (ok && size > INPUT_LOG_BUFFER_SIZE)
+	{
+		ok = false;
+	}
+	if (ok && size > 0)
+	{
+		ok = (1 == fread(m_buffer, size, 1, file));
+	}
+	fclose(file);
+
+	if (ok)
+	{
+		m_ticks = GetWord(&header[5]);
+		m_duration = GetWord(&header[9]);
+		m_size = size;
+		m_dropped = GetWord(&header[17]);
+		if (m_dropped > 0)
+		{
+			printf("Input log %s is truncated: %u ticks were dropped\n", path, m_dropped);
+		}
+	}
+	Rewind();
+	return ok;
+}
+
+void InputLog::Rewind()
+{
+	memset(&m_previous, 0, sizeof(m_previous));
+	m_position = 0;
+	m_replayed = 0;
+}
+
+bool InputLog::Replay(UINT32 now, InputSnapshot &inputs)
+{
+	if (m_replayed >= m_ticks)
+	{
+		return false;
+	}
+
+	InputSnapshot &p = m_previous;
+	UINT32 mask = GetVarint();
+	p.timestamp += GetVarint();
+	if (mask & kFieldStickX)          p.stickX = GetFloat();
+	if (mask & kFieldStickY)          p.stickY = GetFloat();
+	if (mask & kFieldStick2Buttons)   p.stick2Buttons = (UINT16)GetVarint();
+	if (mask & kFieldGamepadLeftX)    p.gamepadLeftX = GetFloat();
+	if (mask & kFieldGamepadLeftY)    p.gamepadLeftY = GetFloat();
+	if (mask & kFieldGamepadRightX)   p.gamepadRightX = GetFloat();
+	if (mask & kFieldGamepadRightY)   p.gamepadRightY = GetFloat();
+	if (mask & kFieldGamepadButtons)  p.gamepadButtons = (UINT16)GetVarint();
+	if (mask & kFieldGamepadDPad)     p.gamepadDPad = (Gamepad::DPadDirection)GetVarint();
+	if (mask & kFieldSwitches)
+	{
+		UINT32 switches = GetByte();
+		p.indexerSwitch = 0 != (switches & kSwitchIndexer);
+		p.greenClawLockSwitch = 0 != (switches & kSwitchGreenClawLock);
+		p.yellowClawLockSwitch = 0 != (switches & kSwitchYellowClawLock);
+		p.pressureSwitch = 0 != (switches & kSwitchPressure);
+	}
+	if (mask & kFieldLeftDriveCount)  p.leftDriveCount += UnZigZag(GetVarint());
+	if (mask & kFieldRightDriveCount) p.rightDriveCount += UnZigZag(GetVarint());
+	if (mask & kFieldLeftDriveRate)   p.leftDriveRate = GetFloat();
+	if (mask & kFieldRightDriveRate)  p.rightDriveRate = GetFloat();
+	if (mask & kFieldPotentiometer)   p.potentiometer = GetFloat();
+	if (mask & kFieldShooterPeriod)   p.shooterPeriod = GetFloat();
+
+	// A truncated log ends at the last whole tick.
+	if (m_position > m_size)
+	{
+		m_replayed = m_ticks;
+		return false;
+	}
+
+	if (0 == m_replayed)
+	{
+		m_offset = now - p.timestamp;
+	}
+	m_replayed++;
+
+	inputs = p;
+	inputs.timestamp = p.timestamp + m_offset;
+	inputs.leftDriveDistance = p.leftDriveCount * DRIVE_ENCODER_DISTANCE_PER_PULSE;
+	inputs.rightDriveDistance = p.rightDriveCount * DRIVE_ENCODER_DISTANCE_PER_PULSE;
+	return true;
+}
+
+void InputLog::SetReplayFile(const char *path)
+{
+	s_replayFile = path;
+}
+
+const char *InputLog::GetReplayFile()
+{
+	return s_replayFile;
+}
+
+void InputLog::PutByte(UINT32 value)
+{
+	m_buffer[m_size++] = (UINT8)value;
+}
+
+// Seven bits at a time, low bits first, with the top bit of each byte set
+// when more follow.
+void InputLog::PutVarint(UINT32 value)
+{
+	while (value >= 0x80)
+	{
+		PutByte((value & 0x7f) | 0x80);
+		value >>= 7;
+	}
+	PutByte(value);
+}
+
+void InputLog::PutFloat(float value)
+{
+	UINT32 bits = FloatBits(value);
+	for (int i = 0; i < 4; i++)
+	{
+		PutByte(bits >> (8 * i));
+	}
+}
+
+UINT32 InputLog::GetByte()
+{
+	if (m_position >= m_size)
+	{
+		// Past the end: flagged by Replay once the tick is decoded
+		m_position = m_size + 1;
+		return 0;
+	}
+	return m_buffer[m_position++];
+}
+
+UINT32 InputLog::GetVarint()
+{
+	UINT32 value = 0;
+	for (int shift = 0; shift < 35; shift += 7)
+	{
+		UINT32 byte = GetByte();
+		value |= (byte & 0x7f) << shift;
+		if (0 == (byte & 0x80))
+		{
+			break;
+		}
+	}
+	return value;
+}
+
+float InputLog::GetFloat()
+{
+	UINT32 bits = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		bits |= GetByte() << (8 * i);
+	}
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
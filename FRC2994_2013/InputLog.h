@@ -0,0 +1,86 @@
+#ifndef INPUTLOG_H_
+#define INPUTLOG_H_
+
+#include "WPILib.h"
+#include "InputSnapshot.h"
+
+// Recording of the raw inputs of every teleop tick, for replaying a match
+// through the handlers later (on the host simulation).
+
+// Each tick is stored as the difference from the one before: a mask of
+// the fields that changed, the time since the last tick, and then only
+// the changed fields. Encoder counts are stored as the change in counts
+// and everything small as a variable length integer, so a tick where
+// nothing moved costs two or three bytes. The log is kept in memory while
+// recording and only written out by Save (once teleop is over), so the
+// loop never touches the file system.
+
+// Multi-byte values are written least significant byte first whatever
+// the processor, so a log saved on the cRIO loads on the host.
+
+// Derived values (drive distances) are not stored; Replay works them out
+// from the counts again. Encoder rates and the shooter period are stored
+// as floats.
+
+// Largest encoding of one tick (every field changed)
+#define INPUT_LOG_MAX_TICK 80
+// Ticks in a whole teleop period (27000 at TELEOP_LOOP_PERIOD, plus some
+// slack for the loop running a little long). The buffer holds that many
+// even if every field changes every tick; anything past it (a long
+// practice session) is dropped, counted in the file header and shown on
+// the dashboard.
+#define INPUT_LOG_MAX_TICKS 28000
+#define INPUT_LOG_BUFFER_SIZE (INPUT_LOG_MAX_TICKS * INPUT_LOG_MAX_TICK)
+
+class InputLog
+{
+public:
+	InputLog();
+	~InputLog();
+
+	// Recording. Start throws away whatever the log held.
+	void StartRecording();
+	void Record(const InputSnapshot &inputs);
+	bool Save(const char *path);
+
+	// Replay. Load reads a saved log and rewinds it; Replay fills in the
+	// next tick and returns false once the log is used up. The recorded
+	// times are moved so the first replayed tick happens at now.
+	bool Load(const char *path);
+	void Rewind();
+	bool Replay(UINT32 now, InputSnapshot &inputs);
+
+	UINT32 GetTickCount() { return m_ticks; }
+	UINT32 GetSize() { return m_size; }
+	// Ticks not recorded because the buffer was full
+	UINT32 GetDroppedCount() { return m_dropped; }
+	// Seconds from the first to the last tick
+	double GetDuration() { return m_duration / 1e6; }
+
+	// Log the robot should replay in teleop instead of reading its
+	// inputs, or NULL (the default) to drive from the real inputs. Only
+	// the host simulation sets this.
+	static void SetReplayFile(const char *path);
+	static const char *GetReplayFile();
+
+private:
+	void PutByte(UINT32 value);
+	void PutVarint(UINT32 value);
+	void PutFloat(float value);
+	UINT32 GetByte();
+	UINT32 GetVarint();
+	float GetFloat();
+
+	InputSnapshot m_previous;
+	UINT32 m_size;
+	UINT32 m_position;
+	UINT32 m_ticks;
+	UINT32 m_replayed;
+	UINT32 m_dropped;
+	UINT32 m_duration;
+	UINT32 m_offset;
+	UINT8 m_buffer[INPUT_LOG_BUFFER_SIZE];
+
+	static const char *s_replayFile;
+};
+#endif
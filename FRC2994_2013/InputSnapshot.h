@@ -0,0 +1,55 @@
+#ifndef INPUTSNAPSHOT_H_
+#define INPUTSNAPSHOT_H_
+
+#include "WPILib.h"
+#include "Gamepad.h"
+
+// Every input the control loop looks at, sampled exactly once at the top of
+// a tick. The E* event wrappers are updated from it and the handlers read
+// it instead of going back to the driver station or the FPGA, so every
+// handler sees the same instant and nothing is read twice.
+
+typedef struct
+{
+	UINT32 timestamp;                // FPGA time of the sample (us)
+
+	// Joystick 1 (driving)
+	float stickX;
+	float stickY;
+
+	// Joystick 2 (shifter)
+	UINT16 stick2Buttons;
+
+	// Gamepad
+	float gamepadLeftX;
+	float gamepadLeftY;
+	float gamepadRightX;
+	float gamepadRightY;
+	UINT16 gamepadButtons;
+	Gamepad::DPadDirection gamepadDPad;
+
+	// Digital inputs (raw: true means the switch is open)
+	bool indexerSwitch;
+	bool greenClawLockSwitch;
+	bool yellowClawLockSwitch;
+	bool pressureSwitch;
+
+	// Drive encoders
+	INT32 leftDriveCount;
+	INT32 rightDriveCount;
+	double leftDriveDistance;
+	double rightDriveDistance;
+	double leftDriveRate;            // inches per second
+	double rightDriveRate;
+
+	// Arm rotation potentiometer (volts), as read and after the pot filter
+	// (see SampleInputs). Everything but the logs uses the filtered value.
+	float potentiometer;
+	float filteredPotentiometer;
+
+	// Shooter wheel sensor: seconds between the last two pulses (infinite
+	// when the wheel is stopped)
+	double shooterPeriod;
+} InputSnapshot;
+
+#endif
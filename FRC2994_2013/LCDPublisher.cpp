@@ -0,0 +1,158 @@
+#include "LCDPublisher.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+LCDPublisher::LCDPublisher(TelemetryTask &telemetry, double flushPeriod):
+	m_telemetry(telemetry)
+{
+	// Every line starts out blank and unsent, so the first flush clears
+	// whatever the LCD showed before.
+	for (INT32 i = 0; i < DriverStationLCD::kNumLines; i++)
+	{
+		m_lines[i].type = kText;
+		m_lines[i].format = NULL;
+		m_lines[i].integer = 0;
+		m_lines[i].real = 0.0;
+		m_lines[i].dirty = true;
+		m_lines[i].queued = false;
+		m_lines[i].sent = false;
+		m_lines[i].text[0] = '\0';
+	}
+
+	m_flushPeriod = (UINT32)(flushPeriod * 1e6);
+	m_lastFlush = 0;
+	m_started = false;
+	m_updatePending = false;
+
+	m_formats = 0;
+	m_updates = 0;
+}
+
+LCDPublisher::~LCDPublisher()
+{
+}
+
+void LCDPublisher::SetNumber(DriverStationLCD::Line line, const char *format, INT32 value)
+{
+	Line &entry = m_lines[line];
+	if (kInteger != entry.type || format != entry.format || value != entry.integer)
+	{
+		entry.type = kInteger;
+		entry.format = format;
+		entry.integer = value;
+		entry.dirty = true;
+	}
+}
+
+void LCDPublisher::SetNumber(DriverStationLCD::Line line, const char *format, double value)
+{
+	Line &entry = m_lines[line];
+	if (kReal != entry.type || format != entry.format || value != entry.real)
+	{
+		entry.type = kReal;
+		entry.format = format;
+		entry.real = value;
+		entry.dirty = true;
+	}
+}
+
+void LCDPublisher::PrintfLine(DriverStationLCD::Line line, const char *format, ...)
+{
+	Line &entry = m_lines[line];
+	char text[DriverStationLCD::kLineLength + 1];
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(text, sizeof(text), format, args);
+	va_end(args);
+	m_formats++;
+
+	entry.type = kText;
+	entry.format = NULL;
+	if (0 != strcmp(text, entry.text))
+	{
+		strcpy(entry.text, text);
+		entry.queued = false;
+		entry.sent = false;
+	}
+	entry.dirty = true;
+}
+
+void LCDPublisher::Flush(UINT32 now)
+{
+	if (!m_started)
+	{
+		m_started = true;
+	}
+	else if ((INT32)(now - m_lastFlush) < (INT32)m_flushPeriod)
+	{
+		return;
+	}
+	m_lastFlush = now;
+
+	for (INT32 i = 0; i < DriverStationLCD::kNumLines; i++)
+	{
+		Line &entry = m_lines[i];
+		if (!entry.dirty)
+		{
+			continue;
+		}
+		Format(entry);
+		if (entry.sent || entry.queued)
+		{
+			// Formats to what the LCD already shows, or will
+			entry.dirty = false;
+			continue;
+		}
+		if (!m_telemetry.PrintfLine((DriverStationLCD::Line)i, "%s", entry.text))
+		{
+			// Telemetry ring full: the line stays dirty for next time
+			continue;
+		}
+		entry.dirty = false;
+		entry.queued = true;
+		m_updatePending = true;
+	}
+
+	// Until the UpdateLCD is queued the new text only sits in the driver
+	// station's buffer, so keep trying on later flushes.
+	if (m_updatePending && m_telemetry.UpdateLCD())
+	{
+		m_updatePending = false;
+		m_updates++;
+		for (INT32 i = 0; i < DriverStationLCD::kNumLines; i++)
+		{
+			if (m_lines[i].queued)
+			{
+				m_lines[i].queued = false;
+				m_lines[i].sent = true;
+			}
+		}
+	}
+}
+
+// Bring a number line's text up to date; a changed text is marked unsent.
+void LCDPublisher::Format(Line &entry)
+{
+	char text[DriverStationLCD::kLineLength + 1];
+	switch (entry.type)
+	{
+	case kText:
+		return;
+	case kInteger:
+		snprintf(text, sizeof(text), entry.format, entry.integer);
+		break;
+	case kReal:
+		snprintf(text, sizeof(text), entry.format, entry.real);
+		break;
+	}
+	m_formats++;
+
+	if (0 != strcmp(text, entry.text))
+	{
+		strcpy(entry.text, text);
+		entry.queued = false;
+		entry.sent = false;
+	}
+}
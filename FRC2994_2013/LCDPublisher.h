@@ -0,0 +1,68 @@
+#ifndef LCDPUBLISHER_H_
+#define LCDPUBLISHER_H_
+
+#include "WPILib.h"
+#include "TelemetryTask.h"
+
+// Write-behind front end for the driver station LCD, the counterpart of
+// DashboardPublisher. It keeps a shadow copy of the six user lines. The
+// loop hands it a line's format and current value as often as it likes;
+// that only stores the value and marks the line dirty if it changed.
+// Formatting is put off until Flush, which runs at most once per flush
+// period, formats the dirty lines, and hands the ones whose text really
+// changed to the telemetry task with a single UpdateLCD. A line only counts
+// as sent once that UpdateLCD has been queued; if the telemetry ring is
+// full, the next flush tries again.
+
+// The format of a SetNumber line is not copied, so it has to be a string
+// literal. PrintfLine formats straight away, for lines set once (the
+// banner) rather than every tick.
+
+class LCDPublisher
+{
+public:
+	// Flush period in seconds.
+	LCDPublisher(TelemetryTask &telemetry, double flushPeriod);
+	~LCDPublisher();
+
+	void SetNumber(DriverStationLCD::Line line, const char *format, INT32 value);
+	void SetNumber(DriverStationLCD::Line line, const char *format, double value);
+	void PrintfLine(DriverStationLCD::Line line, const char *format, ...);
+
+	void Flush(UINT32 now);
+
+	// Statistics since construction.
+	UINT32 GetFormatCount() { return m_formats; }
+	UINT32 GetUpdateCount() { return m_updates; }
+
+private:
+	typedef enum
+	{
+		kText, kInteger, kReal
+	} LineType;
+
+	typedef struct
+	{
+		LineType type;
+		const char *format;
+		INT32 integer;
+		double real;
+		bool dirty;
+		bool queued;                 // text is in telemetry, awaiting UpdateLCD
+		bool sent;                   // text has gone out with an UpdateLCD
+		char text[DriverStationLCD::kLineLength + 1];
+	} Line;
+
+	void Format(Line &line);
+
+	TelemetryTask &m_telemetry;
+	Line m_lines[DriverStationLCD::kNumLines];
+	UINT32 m_flushPeriod;
+	UINT32 m_lastFlush;
+	bool m_started;
+	bool m_updatePending;
+
+	UINT32 m_formats;
+	UINT32 m_updates;
+};
+#endif
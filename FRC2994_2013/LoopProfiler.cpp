@@ -0,0 +1,149 @@
+#include "LoopProfiler.h"
+#include <stdio.h>
+#include <string.h>
+
+LatencyHistogram::LatencyHistogram()
+{
+	Reset();
+}
+
+void LatencyHistogram::Reset()
+{
+	memset(m_buckets, 0, sizeof(m_buckets));
+	m_count = 0;
+	m_max = 0;
+}
+
+UINT32 LatencyHistogram::BucketUpperBound(UINT32 bucket)
+{
+	if (bucket < kLinearBuckets)
+	{
+		return bucket;
+	}
+	UINT32 msb = 4 + (bucket - kLinearBuckets) / kSubBuckets;
+	UINT32 sub = (bucket - kLinearBuckets) % kSubBuckets;
+	UINT32 width = 1u << (msb - 3);
+	return ((kSubBuckets + sub) << (msb - 3)) + (width - 1);
+}
+
+UINT32 LatencyHistogram::GetPercentile(UINT32 percent)
+{
+	if (0 == m_count)
+	{
+		return 0;
+	}
+
+	// Rank of the requested sample, rounded up so p100 is the last one.
+	UINT32 rank = (UINT32)(((double)m_count * percent + 99) / 100);
+	if (rank < 1)
+	{
+		rank = 1;
+	}
+
+	UINT32 seen = 0;
+	for (UINT32 i = 0; i < kNumBuckets; i++)
+	{
+		seen += m_buckets[i];
+		if (seen >= rank)
+		{
+			UINT32 bound = BucketUpperBound(i);
+			return bound < m_max ? bound : m_max;
+		}
+	}
+	return m_max;
+}
+
+LoopProfiler::LoopProfiler()
+{
+	for (UINT32 i = 0; i < LOOP_PROFILER_MAX_STAGES; i++)
+	{
+		m_names[i] = NULL;
+		m_budgets[i] = 0;
+	}
+	Reset();
+}
+
+bool LoopProfiler::SetStageName(UINT32 stage, const char *name)
+{
+	if (stage >= LOOP_PROFILER_MAX_STAGES)
+	{
+		return false;
+	}
+
+	m_names[stage] = name;
+	return true;
+}
+
+bool LoopProfiler::SetStageBudget(UINT32 stage, double budget)
+{
+	if (stage >= LOOP_PROFILER_MAX_STAGES)
+	{
+		return false;
+	}
+
+	m_budgets[stage] = (UINT32)(budget * 1e6 * CYCLES_PER_MICROSECOND);
+	return true;
+}
+
+void LoopProfiler::Reset()
+{
+	for (UINT32 i = 0; i < LOOP_PROFILER_MAX_STAGES; i++)
+	{
+		m_stages[i].Reset();
+		m_overruns[i] = 0;
+	}
+	m_tick.Reset();
+	m_tickStart = ReadCycleCounter();
+	m_lastMark = m_tickStart;
+}
+
+float LoopProfiler::GetPercentile(UINT32 stage, UINT32 percent)
+{
+	return m_stages[stage].GetPercentile(percent) / CYCLES_PER_MICROSECOND;
+}
+
+float LoopProfiler::GetMax(UINT32 stage)
+{
+	return m_stages[stage].GetMax() / CYCLES_PER_MICROSECOND;
+}
+
+float LoopProfiler::GetTickPercentile(UINT32 percent)
+{
+	return m_tick.GetPercentile(percent) / CYCLES_PER_MICROSECOND;
+}
+
+float LoopProfiler::GetTickMax()
+{
+	return m_tick.GetMax() / CYCLES_PER_MICROSECOND;
+}
+
+void LoopProfiler::DumpLine(const char *name, LatencyHistogram &histogram, UINT32 budget,
+		UINT32 overruns)
+{
+	printf("%-24s %8u %10.2f %10.2f %10.2f", name, histogram.GetCount(),
+			histogram.GetPercentile(50) / CYCLES_PER_MICROSECOND,
+			histogram.GetPercentile(99) / CYCLES_PER_MICROSECOND,
+			histogram.GetMax() / CYCLES_PER_MICROSECOND);
+	if (0 != budget)
+	{
+		printf(" %10.0f %6u\n", budget / CYCLES_PER_MICROSECOND, overruns);
+	}
+	else
+	{
+		printf(" %10s %6s\n", "-", "-");
+	}
+}
+
+void LoopProfiler::Dump()
+{
+	printf("%-24s %8s %10s %10s %10s %10s %6s\n", "stage (us)", "count", "p50", "p99", "max",
+			"budget", "over");
+	for (UINT32 i = 0; i < LOOP_PROFILER_MAX_STAGES; i++)
+	{
+		if (NULL != m_names[i])
+		{
+			DumpLine(m_names[i], m_stages[i], m_budgets[i], m_overruns[i]);
+		}
+	}
+	DumpLine("whole tick", m_tick, 0, 0);
+}
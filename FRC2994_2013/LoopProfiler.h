@@ -0,0 +1,145 @@
+#ifndef LOOPPROFILER_H_
+#define LOOPPROFILER_H_
+
+#include "WPILib.h"
+
+// Lightweight per-stage timing for the robot loops. Each stage gets a
+// fixed-size latency histogram, so recording never allocates and costs a
+// counter read, a subtraction and an increment.
+
+// To use, name the stages once, call BeginTick at the top of every pass,
+// Mark(stage) right after each stage finishes, and EndTick at the bottom.
+// A stage can be given a budget; runs that take longer are counted as
+// overruns. Dump prints count, p50, p99, max and overruns for every stage
+// on the console.
+
+#define LOOP_PROFILER_MAX_STAGES 16
+
+// Monotonic cycle counter used for all timings. Only differences are used,
+// so wrapping of the 32 bit value is harmless for stages shorter than the
+// wrap time (about two minutes on the robot, four seconds on the host).
+#if defined(__PPC__) || defined(__ppc__)
+// PowerPC time base. On the cRIO's MPC5200 it ticks at a quarter of the
+// 133 MHz bus clock.
+#define CYCLES_PER_MICROSECOND 33.333f
+
+inline UINT32 ReadCycleCounter()
+{
+	UINT32 tb;
+	__asm__ __volatile__ ("mftb %0" : "=r" (tb));
+	return tb;
+}
+#else
+// Host build: nanoseconds from the monotonic clock.
+#include <time.h>
+
+#define CYCLES_PER_MICROSECOND 1000.0f
+
+inline UINT32 ReadCycleCounter()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (UINT32)ts.tv_sec * 1000000000u + (UINT32)ts.tv_nsec;
+}
+#endif
+
+// Log-linear histogram of cycle counts: exact below 16 cycles, then eight
+// buckets per power of two (12.5% resolution) up to the full 32 bit range.
+class LatencyHistogram
+{
+public:
+	static const UINT32 kLinearBuckets = 16;
+	static const UINT32 kSubBuckets = 8;
+	static const UINT32 kNumBuckets = kLinearBuckets + (32 - 4) * kSubBuckets;
+
+	LatencyHistogram();
+
+	void Reset();
+	void Record(UINT32 cycles)
+	{
+		m_buckets[BucketOf(cycles)]++;
+		m_count++;
+		if (cycles > m_max)
+		{
+			m_max = cycles;
+		}
+	}
+
+	UINT32 GetCount() { return m_count; }
+	UINT32 GetMax() { return m_max; }
+	// Upper bound of the bucket holding the given percentile (0-100).
+	UINT32 GetPercentile(UINT32 percent);
+
+private:
+	static UINT32 BucketOf(UINT32 cycles)
+	{
+		if (cycles < kLinearBuckets)
+		{
+			return cycles;
+		}
+		UINT32 msb = 31 - __builtin_clz(cycles);
+		UINT32 sub = (cycles >> (msb - 3)) & (kSubBuckets - 1);
+		return kLinearBuckets + (msb - 4) * kSubBuckets + sub;
+	}
+	static UINT32 BucketUpperBound(UINT32 bucket);
+
+	UINT32 m_buckets[kNumBuckets];
+	UINT32 m_count;
+	UINT32 m_max;
+};
+
+class LoopProfiler
+{
+public:
+	LoopProfiler();
+
+	bool SetStageName(UINT32 stage, const char *name);
+	// Seconds; zero for none.
+	bool SetStageBudget(UINT32 stage, double budget);
+	void Reset();
+
+	void BeginTick()
+	{
+		m_tickStart = ReadCycleCounter();
+		m_lastMark = m_tickStart;
+	}
+
+	void Mark(UINT32 stage)
+	{
+		UINT32 now = ReadCycleCounter();
+		UINT32 cycles = now - m_lastMark;
+		m_stages[stage].Record(cycles);
+		if (0 != m_budgets[stage] && cycles > m_budgets[stage])
+		{
+			m_overruns[stage]++;
+		}
+		m_lastMark = now;
+	}
+
+	void EndTick()
+	{
+		m_tick.Record(ReadCycleCounter() - m_tickStart);
+	}
+
+	// Times in microseconds.
+	float GetPercentile(UINT32 stage, UINT32 percent);
+	float GetMax(UINT32 stage);
+	UINT32 GetOverrunCount(UINT32 stage) { return m_overruns[stage]; }
+	float GetTickPercentile(UINT32 percent);
+	float GetTickMax();
+
+	void Dump();
+
+private:
+	void DumpLine(const char *name, LatencyHistogram &histogram, UINT32 budget,
+			UINT32 overruns);
+
+	UINT32 m_tickStart;
+	UINT32 m_lastMark;
+	const char *m_names[LOOP_PROFILER_MAX_STAGES];
+	LatencyHistogram m_stages[LOOP_PROFILER_MAX_STAGES];
+	UINT32 m_budgets[LOOP_PROFILER_MAX_STAGES];     // cycles
+	UINT32 m_overruns[LOOP_PROFILER_MAX_STAGES];
+	LatencyHistogram m_tick;
+};
+#endif
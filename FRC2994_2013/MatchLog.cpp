@@ -0,0 +1,58 @@
+#include "MatchLog.h"
+#include <stdio.h>
+#include <string.h>
+
+// The record layout is part of the file format: fail the build if a
+// compiler ever lays it out differently.
+typedef char MatchLogRecordSizeCheck[(sizeof(MatchLogRecord) == MATCH_LOG_RECORD_SIZE) ? 1 : -1];
+typedef char MatchLogHeaderSizeCheck[(sizeof(MatchLogHeader) == 24) ? 1 : -1];
+
+MatchLog::MatchLog()
+{
+	Clear();
+}
+
+MatchLog::~MatchLog()
+{
+}
+
+void MatchLog::Clear()
+{
+	m_count = 0;
+	m_dropped = 0;
+}
+
+MatchLogRecord *MatchLog::Append()
+{
+	if (m_count >= MATCH_LOG_MAX_RECORDS)
+	{
+		m_dropped++;
+		return NULL;
+	}
+	return &m_records[m_count++];
+}
+
+bool MatchLog::Save(const char *path)
+{
+	FILE *file = fopen(path, "wb");
+	if (NULL == file)
+	{
+		return false;
+	}
+
+	MatchLogHeader header;
+	memcpy(header.magic, MATCH_LOG_MAGIC, sizeof(header.magic));
+	header.byteOrder = MATCH_LOG_BYTE_ORDER;
+	header.version = MATCH_LOG_VERSION;
+	header.recordSize = sizeof(MatchLogRecord);
+	header.count = m_count;
+	header.dropped = m_dropped;
+
+	bool ok = (1 == fwrite(&header, sizeof(header), 1, file)) &&
+		(0 == m_count || m_count == fwrite(m_records, sizeof(MatchLogRecord), m_count, file));
+	if (0 != fclose(file))
+	{
+		ok = false;
+	}
+	return ok;
+}
@@ -0,0 +1,111 @@
+#ifndef MATCHLOG_H_
+#define MATCHLOG_H_
+
+#include "WPILib.h"
+
+// Black box for post-match analysis: one fixed-width record per loop tick
+// (inputs, motor outputs, solenoids, shift count and how long the tick
+// took) in an array set aside when the robot starts. Logging a tick is
+// filling in the next record in place; nothing is allocated or formatted
+// in the loop. Save writes the header and the records out in one go once
+// the loop is over.
+
+// The file is the header followed by the records exactly as they sit in
+// memory, in the byte order of the robot that wrote it (see byteOrder), so
+// a reader can map it and use the records where they lie. Every field is
+// naturally aligned and the record has no hidden padding, so the layout is
+// the same for the PPC and the host compilers. Change the layout only
+// together with MATCH_LOG_VERSION.
+
+#define MATCH_LOG_MAGIC "WHML"
+#define MATCH_LOG_VERSION 1
+#define MATCH_LOG_BYTE_ORDER 0x01020304
+// A whole match at 200 Hz
+#define MATCH_LOG_MAX_RECORDS 32768
+
+typedef enum
+{
+	kMatchLogAutonomous, kMatchLogTeleop
+} MatchLogMode;
+
+// Bits of MatchLogRecord::switches
+#define MATCH_LOG_INDEXER_SWITCH     0x01
+#define MATCH_LOG_GREEN_CLAW_SWITCH  0x02
+#define MATCH_LOG_YELLOW_CLAW_SWITCH 0x04
+#define MATCH_LOG_PRESSURE_SWITCH    0x08
+
+// MatchLogRecord::solenoids holds a DoubleSolenoid::Value (two bits) for
+// each of these
+#define MATCH_LOG_SHIFTER_SHIFT     0
+#define MATCH_LOG_GREEN_CLAW_SHIFT  2
+#define MATCH_LOG_YELLOW_CLAW_SHIFT 4
+
+typedef struct
+{
+	char magic[4];
+	UINT32 byteOrder;                // MATCH_LOG_BYTE_ORDER as the writer saw it
+	UINT32 version;
+	UINT32 recordSize;
+	UINT32 count;
+	UINT32 dropped;                  // records lost to a full log
+} MatchLogHeader;
+
+typedef struct
+{
+	UINT32 timestamp;                // FPGA time at the top of the tick (us)
+	UINT32 loopTime;                 // time spent in the tick (us)
+
+	// Inputs
+	float stickX;
+	float stickY;
+	float gamepadLeftX;
+	float gamepadLeftY;
+	float gamepadRightX;
+	float gamepadRightY;
+	float potentiometer;
+	float shooterRPM;
+	INT32 leftDriveCount;
+	INT32 rightDriveCount;
+
+	// Outputs
+	float leftDrive;
+	float rightDrive;
+	float shooter;
+	float indexer;
+	float arm;
+
+	UINT16 stick2Buttons;
+	UINT16 gamepadButtons;
+	INT16 shiftCount;                // shifts the air budget allows
+	UINT16 spare;
+	UINT8 gamepadDPad;
+	UINT8 switches;
+	UINT8 solenoids;
+	UINT8 mode;                      // MatchLogMode
+} MatchLogRecord;
+
+#define MATCH_LOG_RECORD_SIZE 80
+
+class MatchLog
+{
+public:
+	MatchLog();
+	~MatchLog();
+
+	void Clear();
+
+	// The record for this tick, to be filled in by the caller, or NULL
+	// once the log is full.
+	MatchLogRecord *Append();
+
+	bool Save(const char *path);
+
+	UINT32 GetCount() { return m_count; }
+	UINT32 GetDroppedCount() { return m_dropped; }
+
+private:
+	UINT32 m_count;
+	UINT32 m_dropped;
+	MatchLogRecord m_records[MATCH_LOG_MAX_RECORDS];
+};
+#endif
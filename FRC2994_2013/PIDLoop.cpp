@@ -0,0 +1,36 @@
+#include "PIDLoop.h"
+
+PIDLoop::PIDLoop(double p, double i, double d, double integralLimit):
+	m_p(p),
+	m_i(i),
+	m_d(d),
+	m_integralLimit(integralLimit),
+	m_integral(0.0)
+{
+}
+
+PIDLoop::~PIDLoop()
+{
+}
+
+void PIDLoop::Reset()
+{
+	m_integral = 0.0;
+}
+
+double PIDLoop::Calculate(double error, double errorRate, double dt)
+{
+	if (dt > 0.0)
+	{
+		m_integral += error * dt;
+		if (m_integral > m_integralLimit)
+		{
+			m_integral = m_integralLimit;
+		}
+		else if (m_integral < -m_integralLimit)
+		{
+			m_integral = -m_integralLimit;
+		}
+	}
+	return m_p * error + m_i * m_integral + m_d * errorRate;
+}
@@ -0,0 +1,32 @@
+#ifndef PIDLOOP_H_
+#define PIDLOOP_H_
+
+// Proportional-integral-derivative term for controllers that are stepped
+// from the robot loop. Unlike the WPILib PIDController it has no thread or
+// timer of its own: the caller works out the error each pass and calls
+// Calculate with the time since the last pass.
+
+// The derivative term takes the error rate from the caller (usually a
+// velocity error against a measured rate) instead of differencing the
+// error, so a setpoint that moves in steps does not kick the output.
+
+class PIDLoop
+{
+public:
+	// The integral (error times seconds) is clamped to +/- integralLimit.
+	PIDLoop(double p, double i, double d, double integralLimit);
+	~PIDLoop();
+
+	void Reset();
+	double Calculate(double error, double errorRate, double dt);
+
+	double GetIntegral() { return m_integral; }
+
+private:
+	double m_p;
+	double m_i;
+	double m_d;
+	double m_integralLimit;
+	double m_integral;
+};
+#endif
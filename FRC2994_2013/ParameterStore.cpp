@@ -0,0 +1,174 @@
+#include "ParameterStore.h"
+#include "AnalogFilter.h"
+#include "SpscRing.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PARAMETER_MAX_LINE 128
+#define PARAMETER_MAX_NAME 32
+
+typedef enum
+{
+	kParameterDouble, kParameterInt
+} ParameterType;
+
+// Values outside minimum..maximum are rejected like unknown names.
+typedef struct
+{
+	const char *name;
+	size_t offset;
+	ParameterType type;
+	double minimum;
+	double maximum;
+} ParameterInfo;
+
+#define PARAMETER(field, type, minimum, maximum) \
+	{ #field, offsetof(TuningParameters, field), type, minimum, maximum }
+
+static const ParameterInfo s_parameters[] =
+{
+	PARAMETER(shooterSpinupTime, kParameterDouble, 0.0, 10.0),
+	PARAMETER(reSpinupTime, kParameterDouble, 0.0, 10.0),
+	PARAMETER(climbLimit, kParameterDouble, 0.0, 5.0),
+	PARAMETER(descendLimit, kParameterDouble, 0.0, 5.0),
+	PARAMETER(armJogStep, kParameterDouble, 0.01, 1.0),
+	PARAMETER(shooterForward, kParameterDouble, 0.1, 1.0),
+	PARAMETER(indexerForward, kParameterDouble, 0.1, 1.0),
+	PARAMETER(potEpsilon, kParameterDouble, 0.0, 1.0),
+	PARAMETER(potMedianTaps, kParameterInt, 1, ANALOG_FILTER_MAX_TAPS),
+	PARAMETER(potFilterTime, kParameterDouble, 0.0, 1.0),
+	PARAMETER(airFillRate, kParameterDouble, 0.1, 20.0),
+	PARAMETER(clawReserve, kParameterInt, 0, 20)
+};
+
+#define NUM_PARAMETERS (sizeof(s_parameters) / sizeof(s_parameters[0]))
+
+ParameterStore::ParameterStore(const TuningParameters &defaults):
+	m_current(&m_buffers[0]),
+	m_pending(false)
+{
+	m_buffers[0] = defaults;
+	m_buffers[1] = defaults;
+}
+
+ParameterStore::~ParameterStore()
+{
+}
+
+bool ParameterStore::Load(const char *path)
+{
+	bool ok = Stage(path);
+	Apply();
+	return ok;
+}
+
+bool ParameterStore::Stage(const char *path)
+{
+	if (m_pending)
+	{
+		return false;
+	}
+
+	FILE *file = fopen(path, "r");
+	if (NULL == file)
+	{
+		return false;
+	}
+
+	TuningParameters &staged = (m_current == &m_buffers[0]) ? m_buffers[1] : m_buffers[0];
+	staged = *m_current;
+
+	char line[PARAMETER_MAX_LINE];
+	UINT32 number = 0;
+	bool ok = true;
+	while (NULL != fgets(line, sizeof(line), file))
+	{
+		number++;
+		if (!Parse(line, staged))
+		{
+			printf("%s:%u: bad line \"%s\"\n", path, number, strtok(line, "\r\n"));
+			ok = false;
+		}
+	}
+	fclose(file);
+
+	// Pot volts go down as the arm climbs
+	if (staged.climbLimit >= staged.descendLimit)
+	{
+		printf("%s: climbLimit must be below descendLimit\n", path);
+		ok = false;
+	}
+	if (!ok)
+	{
+		printf("%s: not applied, keeping the current values\n", path);
+		return false;
+	}
+
+	// The values have to be in memory before the loop can see the flag.
+	SPSC_MEMORY_BARRIER();
+	m_pending = true;
+	return true;
+}
+
+bool ParameterStore::Apply()
+{
+	if (!m_pending)
+	{
+		return false;
+	}
+	SPSC_MEMORY_BARRIER();
+	m_current = (m_current == &m_buffers[0]) ? &m_buffers[1] : &m_buffers[0];
+	m_pending = false;
+	return true;
+}
+
+// Returns false for a line that is neither blank, a comment nor a known
+// name and a number in its range.
+bool ParameterStore::Parse(const char *line, TuningParameters &parameters)
+{
+	char name[PARAMETER_MAX_NAME];
+	int used = 0;
+	if (1 != sscanf(line, " %31[^=# \t\r\n] %n", name, &used))
+	{
+		// Nothing but white space or a comment
+		line += strspn(line, " \t\r\n");
+		return '\0' == *line || '#' == *line;
+	}
+
+	const char *value = line + used;
+	if ('=' == *value)
+	{
+		value++;
+	}
+	char *end;
+	double number = strtod(value, &end);
+	end += strspn(end, " \t\r\n");
+	if (end == value || ('\0' != *end && '#' != *end))
+	{
+		return false;
+	}
+
+	for (UINT32 i = 0; i < NUM_PARAMETERS; i++)
+	{
+		if (0 == strcmp(name, s_parameters[i].name))
+		{
+			if (number < s_parameters[i].minimum || number > s_parameters[i].maximum)
+			{
+				return false;
+			}
+			char *field = (char *)&parameters + s_parameters[i].offset;
+			if (kParameterInt == s_parameters[i].type)
+			{
+				*(INT32 *)field = (INT32)number;
+			}
+			else
+			{
+				*(double *)field = number;
+			}
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,63 @@
+#ifndef PARAMETERSTORE_H_
+#define PARAMETERSTORE_H_
+
+#include "WPILib.h"
+
+// Tuning values that can be changed at an event without a rebuild. They
+// are read from a text file on the robot, one "name value" (or
+// "name = value") per line, "#" starting a comment; names not in the file
+// keep their defaults (the #defines in BasicDefines.h and the robot
+// profile). Each name has a range (see ParameterStore.cpp), and a file with
+// an unknown name, a bad number or a value out of range is not used at all.
+
+// The loop reads the values as plain members of the struct returned by
+// Get. Two copies are kept: Stage reads a file into the copy the loop is
+// not using and marks it ready, and Apply, called by the loop between
+// ticks, switches over to it. A tick therefore always sees one complete
+// set of values, and Stage can run from another task. Only one task may
+// call Stage.
+
+typedef struct
+{
+	double shooterSpinupTime;        // seconds (see SHOOTER_SPINUP_TIME)
+	double reSpinupTime;
+	double climbLimit;               // arm pot volts
+	double descendLimit;
+	double armJogStep;               // arm pot volts per dpad press
+	double shooterForward;           // motor settings
+	double indexerForward;
+	double potEpsilon;               // dashboard dead-band, volts
+	INT32 potMedianTaps;             // pot filter (see POT_MEDIAN_TAPS)
+	double potFilterTime;
+	double airFillRate;              // psi/s (see AIR_FILL_RATE)
+	INT32 clawReserve;               // claw actuations
+} TuningParameters;
+
+class ParameterStore
+{
+public:
+	explicit ParameterStore(const TuningParameters &defaults);
+	~ParameterStore();
+
+	// Stage the file and apply it straight away (at startup, before the
+	// loop runs).
+	bool Load(const char *path);
+
+	// Read the file into the spare copy, starting from the current values.
+	// Returns false if the file cannot be read, a staged set is still
+	// waiting to be applied or the file has bad lines; bad lines are
+	// reported and the staged copy is thrown away.
+	bool Stage(const char *path);
+
+	// Loop side. Returns true if a staged set was switched in.
+	bool Apply();
+	const TuningParameters &Get() { return *m_current; }
+
+private:
+	bool Parse(const char *line, TuningParameters &parameters);
+
+	TuningParameters m_buffers[2];
+	TuningParameters *m_current;
+	volatile bool m_pending;
+};
+#endif
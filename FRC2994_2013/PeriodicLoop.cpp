@@ -0,0 +1,95 @@
+#include "PeriodicLoop.h"
+#include "Utility.h"
+
+PeriodicLoop::PeriodicLoop(double period)
+{
+	m_period = (UINT32)(period * 1e6);
+	Start();
+}
+
+PeriodicLoop::~PeriodicLoop()
+{
+}
+
+void PeriodicLoop::Start()
+{
+	m_nextDeadline = GetFPGATime() + m_period;
+	m_ticks = 0;
+	m_overruns = 0;
+	m_skipped = 0;
+	m_lastJitter = 0;
+	m_maxJitter = 0;
+	m_totalJitter = 0.0;
+}
+
+void PeriodicLoop::WaitForNextTick()
+{
+	// The FPGA clock wraps every 71 minutes, so all comparisons are done on
+	// the signed difference rather than on the raw times.
+	INT32 remaining = (INT32)(m_nextDeadline - GetFPGATime());
+
+	if (remaining > 0)
+	{
+		Wait(remaining * 1e-6);
+	}
+	else
+	{
+		// Overrun: start the next pass now.
+		m_overruns++;
+	}
+
+	// Keep the original cadence, dropping any ticks that were missed
+	// completely, whether the pass ran long or the wait overslept.
+	INT32 woke = (INT32)(GetFPGATime() - m_nextDeadline);
+	UINT32 late = woke > 0 ? woke : 0;
+	UINT32 missed = late / m_period;
+	m_skipped += missed;
+	m_nextDeadline += (missed + 1) * m_period;
+
+	m_ticks++;
+	m_lastJitter = late;
+	m_totalJitter += late;
+	if (late > m_maxJitter)
+	{
+		m_maxJitter = late;
+	}
+}
+
+UINT32 PeriodicLoop::GetTickCount()
+{
+	return m_ticks;
+}
+
+UINT32 PeriodicLoop::GetOverrunCount()
+{
+	return m_overruns;
+}
+
+UINT32 PeriodicLoop::GetSkippedTicks()
+{
+	return m_skipped;
+}
+
+UINT32 PeriodicLoop::GetLastJitter()
+{
+	return m_lastJitter;
+}
+
+UINT32 PeriodicLoop::GetMaxJitter()
+{
+	return m_maxJitter;
+}
+
+UINT32 PeriodicLoop::GetMeanJitter()
+{
+	if (0 == m_ticks)
+	{
+		return 0;
+	}
+	return (UINT32)(m_totalJitter / m_ticks);
+}
+
+UINT32 PeriodicLoop::GetPeriod()
+{
+	return m_period;
+}
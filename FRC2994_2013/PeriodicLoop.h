@@ -0,0 +1,44 @@
+#ifndef PERIODICLOOP_H_
+#define PERIODICLOOP_H_
+
+#include "WPILib.h"
+
+// Runs a loop body at a fixed rate using absolute deadlines on the FPGA
+// clock, so the period does not stretch with the time the body takes.
+
+// To use, call Start once just before you enter your loop and then call
+// WaitForNextTick at the end of every pass. If a pass runs past its
+// deadline the next one starts immediately; if it (or the wait) runs past
+// one or more whole periods those ticks are skipped (and counted) rather
+// than run back to back to catch up.
+
+class PeriodicLoop
+{
+public:
+	explicit PeriodicLoop(double period);
+	~PeriodicLoop();
+
+	void Start();
+	void WaitForNextTick();
+
+	// Statistics since the last Start (times in microseconds). Jitter is
+	// how late a tick started relative to its deadline.
+	UINT32 GetTickCount();
+	UINT32 GetOverrunCount();
+	UINT32 GetSkippedTicks();
+	UINT32 GetLastJitter();
+	UINT32 GetMaxJitter();
+	UINT32 GetMeanJitter();
+	UINT32 GetPeriod();
+
+private:
+	UINT32 m_period;
+	UINT32 m_nextDeadline;
+	UINT32 m_ticks;
+	UINT32 m_overruns;
+	UINT32 m_skipped;
+	UINT32 m_lastJitter;
+	UINT32 m_maxJitter;
+	double m_totalJitter;
+};
+#endif
@@ -0,0 +1,110 @@
+#include "PneumaticsSubsystem.h"
+#include "BasicDefines.h"
+
+PneumaticsSubsystem::PneumaticsSubsystem(DoubleSolenoid::Value highGear,
+		DoubleSolenoid::Value lowGear, bool clawSensorInverted):
+	Subsystem("Pneumatics", PNEUMATICS_UPDATE_BUDGET),
+	m_compressor(COMPRESSOR_PRESSURE_SW, COMPRESSOR_SPIKE),
+	m_shifter(SHIFTER_A, SHIFTER_B),
+	m_greenClaw(GREEN_CLAW_LOCKED, GREEN_CLAW_UNLOCKED),
+	m_yellowClaw(YELLOW_CLAW_LOCKED, YELLOW_CLAW_UNLOCKED),
+	m_greenSensor(GREEN_LOCK_SENSOR),
+	m_yellowSensor(YELLOW_LOCK_SENSOR),
+	m_highGear(highGear),
+	m_lowGear(lowGear),
+	m_clawSensorInverted(clawSensorInverted),
+	m_air(),
+	m_clawReserve(AIR_CLAW_RESERVE)
+{
+	m_shifter.Set(DoubleSolenoid::kReverse);
+	m_greenSensor.SetDebounce(CLAW_SENSOR_DEBOUNCE_SAMPLES, CLAW_SENSOR_DEBOUNCE_TIME);
+	m_yellowSensor.SetDebounce(CLAW_SENSOR_DEBOUNCE_SAMPLES, CLAW_SENSOR_DEBOUNCE_TIME);
+}
+
+PneumaticsSubsystem::~PneumaticsSubsystem()
+{
+}
+
+void PneumaticsSubsystem::ReadInputs(InputSnapshot &inputs)
+{
+	inputs.greenClawLockSwitch = m_greenSensor.Get();
+	inputs.yellowClawLockSwitch = m_yellowSensor.Get();
+	inputs.pressureSwitch = m_compressor.GetPressureSwitchValue();
+}
+
+void PneumaticsSubsystem::Start(const InputSnapshot &inputs)
+{
+	m_air.Start(inputs.timestamp, inputs.pressureSwitch);
+	Update(inputs);
+
+	// Known states for everything, whatever the reserve
+	Actuate(m_shifter, m_highGear, AIR_PER_SHIFT);
+	Actuate(m_greenClaw, DoubleSolenoid::kReverse, AIR_PER_CLAW);
+	Actuate(m_yellowClaw, DoubleSolenoid::kReverse, AIR_PER_CLAW);
+
+	m_compressor.Start();
+}
+
+void PneumaticsSubsystem::Update(const InputSnapshot &inputs)
+{
+	m_greenSensor.Update(inputs.greenClawLockSwitch, inputs.timestamp);
+	m_yellowSensor.Update(inputs.yellowClawLockSwitch, inputs.timestamp);
+	m_air.Update(inputs.timestamp, inputs.pressureSwitch, m_compressor.Enabled());
+}
+
+// Air (psi) held back for the claw locks
+double PneumaticsSubsystem::ClawReserve()
+{
+	return m_clawReserve * AIR_PER_CLAW;
+}
+
+int PneumaticsSubsystem::GetShiftsLeft()
+{
+	double spare = m_air.GetReserve() - ClawReserve();
+	return spare > 0.0 ? (int)(spare / AIR_PER_SHIFT) : 0;
+}
+
+void PneumaticsSubsystem::ShiftHigh()
+{
+	Shift(m_highGear);
+}
+
+void PneumaticsSubsystem::ShiftLow()
+{
+	Shift(m_lowGear);
+}
+
+void PneumaticsSubsystem::Shift(DoubleSolenoid::Value gear)
+{
+	if (m_air.CanAfford(AIR_PER_SHIFT, ClawReserve()))
+	{
+		Actuate(m_shifter, gear, AIR_PER_SHIFT);
+	}
+}
+
+void PneumaticsSubsystem::LockClaw(ClawId claw)
+{
+	Actuate(Claw(claw), DoubleSolenoid::kForward, AIR_PER_CLAW);
+}
+
+void PneumaticsSubsystem::UnlockClaw(ClawId claw)
+{
+	Actuate(Claw(claw), DoubleSolenoid::kReverse, AIR_PER_CLAW);
+}
+
+// Only a change of the valve moves the cylinder and uses air
+void PneumaticsSubsystem::Actuate(DoubleSolenoid &valve, DoubleSolenoid::Value value,
+		double cost)
+{
+	if (valve.Get() != value)
+	{
+		valve.Set(value);
+		m_air.Use(cost);
+	}
+}
+
+bool PneumaticsSubsystem::IsClawLocked(ClawId claw)
+{
+	bool closed = (kStateOpen != Sensor(claw).GetState());
+	return m_clawSensorInverted ? !closed : closed;
+}
@@ -0,0 +1,74 @@
+#ifndef PNEUMATICSSUBSYSTEM_H_
+#define PNEUMATICSSUBSYSTEM_H_
+
+#include "WPILib.h"
+#include "Subsystem.h"
+#include "EDigitalInput.h"
+#include "AirBudget.h"
+
+// The compressor and everything that runs on air: the gearbox shifter and
+// the two climbing claws, with the claws' lock sensors. Update debounces
+// the lock sensors and keeps the air estimate (see AirBudget) up to date.
+// The claws always move when asked, but the shifter only shifts when the
+// estimate says there will still be enough air left for the claw lock
+// reserve (SetClawReserve actuations) afterwards, so the drivers get the
+// shifts the compressor has paid for and the climb never runs out of air.
+
+typedef enum
+{
+	kClawGreen, kClawYellow
+} ClawId;
+
+class PneumaticsSubsystem : public Subsystem
+{
+public:
+	// Shifter directions for each gear, and whether the lock sensors read
+	// open when locked (see RobotProfiles.h).
+	PneumaticsSubsystem(DoubleSolenoid::Value highGear, DoubleSolenoid::Value lowGear,
+			bool clawSensorInverted);
+	~PneumaticsSubsystem();
+
+	void ReadInputs(InputSnapshot &inputs);
+	// Compressor on, high gear and both claws unlocked
+	void Start(const InputSnapshot &inputs);
+	void Update(const InputSnapshot &inputs);
+
+	void SetFillRate(double fillRate) { m_air.SetFillRate(fillRate); }
+	void SetClawReserve(int actuations) { m_clawReserve = actuations; }
+	// Shifts that can be made now without touching the claw reserve
+	int GetShiftsLeft();
+	// psi above AIR_MIN_PRESSURE
+	double GetAirReserve() { return m_air.GetReserve(); }
+	void ShiftHigh();
+	void ShiftLow();
+
+	void LockClaw(ClawId claw);
+	void UnlockClaw(ClawId claw);
+	// Going by the claw's lock sensor
+	bool IsClawLocked(ClawId claw);
+	UINT32 GetClawGlitchCount(ClawId claw) { return Sensor(claw).GetGlitchCount(); }
+
+	DoubleSolenoid::Value GetShifter() { return m_shifter.Get(); }
+	DoubleSolenoid::Value GetClaw(ClawId claw) { return Claw(claw).Get(); }
+
+private:
+	void Shift(DoubleSolenoid::Value gear);
+	void Actuate(DoubleSolenoid &valve, DoubleSolenoid::Value value, double cost);
+	double ClawReserve();
+	DoubleSolenoid &Claw(ClawId claw) { return kClawGreen == claw ? m_greenClaw : m_yellowClaw; }
+	EDigitalInput &Sensor(ClawId claw) { return kClawGreen == claw ? m_greenSensor : m_yellowSensor; }
+
+	Compressor m_compressor;
+	DoubleSolenoid m_shifter;
+	DoubleSolenoid m_greenClaw;
+	DoubleSolenoid m_yellowClaw;
+	EDigitalInput m_greenSensor;
+	EDigitalInput m_yellowSensor;
+
+	DoubleSolenoid::Value m_highGear;
+	DoubleSolenoid::Value m_lowGear;
+	bool m_clawSensorInverted;
+	AirBudget m_air;
+	int m_clawReserve;
+};
+#endif
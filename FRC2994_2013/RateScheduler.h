@@ -0,0 +1,172 @@
+#ifndef RATESCHEDULER_H_
+#define RATESCHEDULER_H_
+
+#include "WPILib.h"
+#include "LoopProfiler.h"
+#include "InputSnapshot.h"
+#include "Subsystem.h"
+
+// Runs the teleop loop's work at more than one rate from the one
+// PeriodicLoop. Each task is a member function of the Target (the robot)
+// or a Subsystem's Update, with its own period and priority; the loop calls
+// Run once per base tick with the tick's inputs and the scheduler runs the
+// tasks that are due, highest priority (lowest number) first, marking each
+// one's profiler stage as it finishes. A subsystem's stage is named after
+// it and given its budget.
+
+// Periods are rounded to a whole number of base ticks. A task that does
+// not run every tick gets a phase offset, chosen when it is added, that
+// keeps it off the ticks of the slower tasks added before it wherever the
+// periods allow; add the heavy ones first. Two tasks with periods n and m
+// ticks and phases p and q meet on some tick exactly when p and q are equal
+// modulo the greatest common divisor of n and m.
+
+#define RATE_SCHEDULER_MAX_TASKS 12
+
+template <class Target>
+class RateScheduler
+{
+public:
+	typedef void (Target::*Action)();
+
+	// Base period in seconds (the loop's period).
+	RateScheduler(Target &target, LoopProfiler &profiler, double basePeriod):
+		m_target(target),
+		m_profiler(profiler),
+		m_basePeriod(basePeriod),
+		m_numTasks(0),
+		m_tick(0)
+	{
+	}
+
+	// Returns false if the table is full.
+	bool AddTask(UINT32 stage, Action action, double period, UINT32 priority)
+	{
+		return Add(stage, action, NULL, period, priority);
+	}
+
+	bool AddSubsystem(UINT32 stage, Subsystem &subsystem, double period, UINT32 priority)
+	{
+		m_profiler.SetStageName(stage, subsystem.GetName());
+		m_profiler.SetStageBudget(stage, subsystem.GetBudget());
+		return Add(stage, NULL, &subsystem, period, priority);
+	}
+
+	// Start again from tick zero (at the start of a mode).
+	void Reset() { m_tick = 0; }
+
+	void Run(const InputSnapshot &inputs)
+	{
+		for (UINT32 i = 0; i < m_numTasks; i++)
+		{
+			Task &task = m_tasks[i];
+			if (m_tick % task.divisor == task.phase)
+			{
+				if (NULL != task.subsystem)
+				{
+					task.subsystem->Update(inputs);
+				}
+				else
+				{
+					(m_target.*task.action)();
+				}
+				m_profiler.Mark(task.stage);
+			}
+		}
+		m_tick++;
+	}
+
+	UINT32 GetTickCount() { return m_tick; }
+
+private:
+	typedef struct
+	{
+		UINT32 stage;
+		Action action;
+		Subsystem *subsystem;
+		UINT32 divisor;
+		UINT32 phase;
+		UINT32 priority;
+	} Task;
+
+	bool Add(UINT32 stage, Action action, Subsystem *subsystem, double period,
+			UINT32 priority)
+	{
+		if (m_numTasks >= RATE_SCHEDULER_MAX_TASKS)
+		{
+			return false;
+		}
+
+		UINT32 divisor = (UINT32)(period / m_basePeriod + 0.5);
+		if (divisor < 1)
+		{
+			divisor = 1;
+		}
+
+		UINT32 phase = ChoosePhase(divisor);
+
+		// Insert by priority, after any task of the same priority
+		UINT32 slot = m_numTasks;
+		while (slot > 0 && m_tasks[slot - 1].priority > priority)
+		{
+			m_tasks[slot] = m_tasks[slot - 1];
+			slot--;
+		}
+		Task &task = m_tasks[slot];
+		task.stage = stage;
+		task.action = action;
+		task.subsystem = subsystem;
+		task.divisor = divisor;
+		task.phase = phase;
+		task.priority = priority;
+		m_numTasks++;
+		return true;
+	}
+
+	static UINT32 GreatestCommonDivisor(UINT32 a, UINT32 b)
+	{
+		while (0 != b)
+		{
+			UINT32 r = a % b;
+			a = b;
+			b = r;
+		}
+		return a;
+	}
+
+	// The phase that meets the fewest of the multi-tick tasks so far (the
+	// lowest such phase on a tie). Every-tick tasks meet everything anyway.
+	UINT32 ChoosePhase(UINT32 divisor)
+	{
+		UINT32 best = 0;
+		UINT32 bestMeetings = RATE_SCHEDULER_MAX_TASKS + 1;
+		for (UINT32 phase = 0; phase < divisor && bestMeetings > 0; phase++)
+		{
+			UINT32 meetings = 0;
+			for (UINT32 i = 0; i < m_numTasks; i++)
+			{
+				UINT32 other = m_tasks[i].divisor;
+				if (other > 1 && phase % GreatestCommonDivisor(divisor, other) ==
+						m_tasks[i].phase % GreatestCommonDivisor(divisor, other))
+				{
+					meetings++;
+				}
+			}
+			if (meetings < bestMeetings)
+			{
+				best = phase;
+				bestMeetings = meetings;
+			}
+		}
+		return best;
+	}
+
+	Target &m_target;
+	LoopProfiler &m_profiler;
+	double m_basePeriod;
+	Task m_tasks[RATE_SCHEDULER_MAX_TASKS];
+	UINT32 m_numTasks;
+	UINT32 m_tick;
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef ROBOTPROFILES_H_
+#define ROBOTPROFILES_H_
+
+#include "WPILib.h"
+
+// The hardware differences between our robots, as traits classes that
+// RobotDemo is built on. Everything here is a type or a compile-time
+// constant, so the compiler picks the right motor controllers and folds
+// away the inversion and direction tests; nothing is decided at run time.
+//
+// WhamO1Profile is the competition bot, WhamO2Profile the test bot and
+// PlyboyProfile our development platform. ROBOT_PROFILE (BasicDefines.h)
+// says which one the robot is built as.
+//
+// A profile provides:
+//   DriveMotor, IndexerMotor, ShooterMotor, ArmMotor
+//                         motor controller classes
+//   kInvertLeftDrive      the left drive motors are mounted backwards
+//   kHighGear, kLowGear   shifter solenoid direction for each gear
+//   kClawSensorInverted   the claw lock sensors read open when locked
+//   kReverseLeftEncoder, kReverseRightEncoder
+//                         the drive encoder counts down driving forward,
+//                         so its direction is flipped (both encoders must
+//                         count up driving forward)
+//   Name()                shown on the LCD and by the host simulation
+//   ClimbLimit(), DescendLimit()
+//                         arm pot voltages the arm must not be driven past
+
+struct PlyboyProfile
+{
+	typedef Jaguar DriveMotor;
+	typedef Jaguar IndexerMotor;
+	typedef Jaguar ShooterMotor;
+	typedef Jaguar ArmMotor;
+
+	static const bool kInvertLeftDrive = false;
+	static const DoubleSolenoid::Value kHighGear = DoubleSolenoid::kReverse;
+	static const DoubleSolenoid::Value kLowGear = DoubleSolenoid::kForward;
+	static const bool kClawSensorInverted = false;
+	// Not yet checked on the robot (see WhamO1Profile)
+	static const bool kReverseLeftEncoder = true;
+	static const bool kReverseRightEncoder = false;
+
+	static const char *Name() { return "Plyboy"; }
+	static float ClimbLimit() { return .5f; }
+	static float DescendLimit() { return 4.5f; }
+};
+
+struct WhamO1Profile
+{
+	typedef Victor DriveMotor;
+	typedef Jaguar IndexerMotor;
+	typedef Jaguar ShooterMotor;
+	typedef Talon ArmMotor;
+
+	static const bool kInvertLeftDrive = true;
+	static const DoubleSolenoid::Value kHighGear = DoubleSolenoid::kForward;
+	static const DoubleSolenoid::Value kLowGear = DoubleSolenoid::kReverse;
+	static const bool kClawSensorInverted = true;
+	// Not yet checked on the robot. The left one is reversed as it always
+	// was, but only its absolute distance used to be read, so its sign was
+	// never tested; the right one is the opposite, as it should be on a
+	// mirrored drive train. Drive forward and watch both counts before
+	// trusting closed loop autonomous moves.
+	static const bool kReverseLeftEncoder = true;
+	static const bool kReverseRightEncoder = false;
+
+	static const char *Name() { return "WhamO-1"; }
+	static float ClimbLimit() { return .5f; }
+	static float DescendLimit() { return 4.5f; }
+};
+
+struct WhamO2Profile
+{
+	typedef Victor DriveMotor;
+	typedef Jaguar IndexerMotor;
+	typedef Jaguar ShooterMotor;
+	typedef Victor ArmMotor;
+
+	static const bool kInvertLeftDrive = false;
+	static const DoubleSolenoid::Value kHighGear = DoubleSolenoid::kReverse;
+	static const DoubleSolenoid::Value kLowGear = DoubleSolenoid::kForward;
+	static const bool kClawSensorInverted = true;
+	// Not yet checked on the robot (see WhamO1Profile)
+	static const bool kReverseLeftEncoder = true;
+	static const bool kReverseRightEncoder = false;
+
+	static const char *Name() { return "WhamO-2"; }
+	static float ClimbLimit() { return .5f; }
+	static float DescendLimit() { return 4.5f; }
+};
+
+// RobotDemo built on the named profile, or NULL if there is no such
+// profile. Every profile is compiled into every build, so one host build
+// can run them all.
+RobotBase *CreateRobot(const char *profileName);
+
+#endif
@@ -0,0 +1,67 @@
+#include "ShooterSpeed.h"
+#include "BasicDefines.h"
+
+ShooterSpeed::ShooterSpeed():
+	m_started(false),
+	m_lastUpdate(0),
+	m_rawRPM(0.0),
+	m_filteredRPM(0.0),
+	m_atSpeed(false),
+	m_atSpeedSince(0),
+	m_ready(false)
+{
+}
+
+ShooterSpeed::~ShooterSpeed()
+{
+}
+
+void ShooterSpeed::Update(UINT32 now, double period)
+{
+	if (period > 0.0 && period <= SHOOTER_MAX_PERIOD)
+	{
+		m_rawRPM = 60.0 / (period * SHOOTER_PULSES_PER_REV);
+	}
+	else
+	{
+		m_rawRPM = 0.0;
+	}
+
+	// First order low pass. The weight follows the actual time since the
+	// last update, so a late loop pass does not change the filter's time
+	// constant.
+	if (!m_started)
+	{
+		m_started = true;
+		m_filteredRPM = m_rawRPM;
+	}
+	else
+	{
+		double dt = (INT32)(now - m_lastUpdate) / 1e6;
+		if (dt > 0.0)
+		{
+			m_filteredRPM += dt / (SHOOTER_RPM_FILTER_TIME + dt) * (m_rawRPM - m_filteredRPM);
+		}
+	}
+	m_lastUpdate = now;
+
+	if (m_filteredRPM < SHOOTER_READY_RPM)
+	{
+		m_atSpeed = false;
+	}
+	else if (!m_atSpeed)
+	{
+		m_atSpeed = true;
+		m_atSpeedSince = now;
+	}
+	m_ready = m_atSpeed &&
+		(INT32)(now - m_atSpeedSince) >= (INT32)(SHOOTER_READY_HOLD_TIME * 1e6);
+}
+
+void ShooterSpeed::RestartReady(UINT32 now)
+{
+	// The wheel has to be measured back at speed for the whole hold time
+	m_atSpeed = false;
+	m_atSpeedSince = now;
+	m_ready = false;
+}
@@ -0,0 +1,41 @@
+#ifndef SHOOTERSPEED_H_
+#define SHOOTERSPEED_H_
+
+#include "WPILib.h"
+
+// Shooter wheel speed from the period of the wheel sensor pulses (a Counter
+// on SHOOTER_SPEED_SENSOR), smoothed with a first order filter, and the
+// ready-to-fire test built on it.
+
+// To use, call Update once per pass of the loop with the loop's FPGA time
+// and the counter period sampled for it. The wheel is ready to fire once the
+// filtered speed has stayed at or above SHOOTER_READY_RPM for
+// SHOOTER_READY_HOLD_TIME. Call RestartReady after each shot so the next one
+// waits for the wheel to be seen back at speed, rather than trusting a
+// reading taken before the disk slowed it down.
+
+class ShooterSpeed
+{
+public:
+	ShooterSpeed();
+	~ShooterSpeed();
+
+	// Period in seconds; zero, negative or above SHOOTER_MAX_PERIOD (the
+	// Counter reports infinity when stalled) all mean stopped.
+	void Update(UINT32 now, double period);
+	void RestartReady(UINT32 now);
+
+	double GetRPM() { return m_filteredRPM; }
+	double GetRawRPM() { return m_rawRPM; }
+	bool IsReadyToFire() { return m_ready; }
+
+private:
+	bool m_started;
+	UINT32 m_lastUpdate;
+	double m_rawRPM;
+	double m_filteredRPM;
+	bool m_atSpeed;
+	UINT32 m_atSpeedSince;
+	bool m_ready;
+};
+#endif
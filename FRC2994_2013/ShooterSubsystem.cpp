@@ -0,0 +1,60 @@
+#include "ShooterSubsystem.h"
+#include "BasicDefines.h"
+
+ShooterSubsystem::ShooterSubsystem(SpeedController &shooter, SpeedController &indexer):
+	Subsystem("Shooter", SHOOTER_UPDATE_BUDGET),
+	m_shooter(shooter),
+	m_indexer(indexer),
+	m_counter(SHOOTER_SPEED_SENSOR),
+	m_speed(),
+	m_shooterRunning(false)
+{
+	m_counter.SetMaxPeriod(SHOOTER_MAX_PERIOD);
+	m_counter.Start();
+}
+
+ShooterSubsystem::~ShooterSubsystem()
+{
+}
+
+void ShooterSubsystem::ReadInputs(InputSnapshot &inputs)
+{
+	inputs.shooterPeriod = m_counter.GetPeriod();
+}
+
+void ShooterSubsystem::Update(const InputSnapshot &inputs)
+{
+	m_speed.Update(inputs.timestamp, inputs.shooterPeriod);
+}
+
+void ShooterSubsystem::Stop()
+{
+	m_shooter.Set(0.0);
+	m_shooterRunning = false;
+
+	m_indexer.Set(0.0);
+}
+
+void ShooterSubsystem::ToggleShooter(double forward)
+{
+	if (!m_shooterRunning)
+	{
+		m_shooterRunning = true;
+		m_shooter.Set(forward);
+	}
+	else
+	{
+		m_shooterRunning = false;
+		m_shooter.Set(0.0);
+	}
+}
+
+void ShooterSubsystem::StartIndexer(double forward)
+{
+	m_indexer.Set(forward);
+}
+
+void ShooterSubsystem::StopIndexer()
+{
+	m_indexer.Set(0.0);
+}
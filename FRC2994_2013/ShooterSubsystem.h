@@ -0,0 +1,40 @@
+#ifndef SHOOTERSUBSYSTEM_H_
+#define SHOOTERSUBSYSTEM_H_
+
+#include "WPILib.h"
+#include "Subsystem.h"
+#include "ShooterSpeed.h"
+
+// The shooter wheel and the indexer that feeds it disks. Update keeps the
+// wheel speed estimate (see ShooterSpeed) up to date from the speed sensor;
+// the wheel and indexer are started and stopped by the button bindings, or
+// by AutonomousEngine. The indexer also stops from the indexer switch's
+// interrupt (see EDigitalInput::SetStopAction).
+
+class ShooterSubsystem : public Subsystem
+{
+public:
+	ShooterSubsystem(SpeedController &shooter, SpeedController &indexer);
+	~ShooterSubsystem();
+
+	void ReadInputs(InputSnapshot &inputs);
+	void Update(const InputSnapshot &inputs);
+	// Wheel and indexer off
+	void Stop();
+
+	// Motor settings for running forward
+	void ToggleShooter(double forward);
+	void StartIndexer(double forward);
+	void StopIndexer();
+
+	bool IsShooterRunning() { return m_shooterRunning; }
+	ShooterSpeed &GetSpeed() { return m_speed; }
+
+private:
+	SpeedController &m_shooter;
+	SpeedController &m_indexer;
+	Counter m_counter;
+	ShooterSpeed m_speed;
+	bool m_shooterRunning;
+};
+#endif
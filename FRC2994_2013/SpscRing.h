@@ -0,0 +1,78 @@
+#ifndef SPSCRING_H_
+#define SPSCRING_H_
+
+#include "WPILib.h"
+
+// Fixed-size queue between exactly one producer task and one consumer
+// task, with no lock and no allocation. The producer only writes m_head and
+// the consumer only writes m_tail, so neither side ever waits for the
+// other: a full ring makes Push fail (and count a drop) instead of
+// blocking, and an empty ring makes Pop fail.
+
+// Size must be a power of two. Head and tail run freely and are masked on
+// use, so Size - 1 slots are not lost to telling full from empty and the
+// UINT32 wrap is harmless.
+
+#if defined(__PPC__) || defined(__ppc__)
+// The PowerPC may reorder stores to different addresses, so the slot
+// contents have to be ordered against the index that publishes them.
+#define SPSC_MEMORY_BARRIER() __asm__ __volatile__ ("sync" : : : "memory")
+#else
+#define SPSC_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
+template <typename T, UINT32 Size>
+class SpscRing
+{
+public:
+	SpscRing():
+		m_head(0),
+		m_tail(0),
+		m_dropped(0)
+	{
+	}
+
+	// Producer side.
+	bool Push(const T &item)
+	{
+		UINT32 head = m_head;
+		if (head - m_tail >= Size)
+		{
+			m_dropped++;
+			return false;
+		}
+		m_items[head & (Size - 1)] = item;
+		SPSC_MEMORY_BARRIER();
+		m_head = head + 1;
+		return true;
+	}
+
+	// Consumer side.
+	bool Pop(T &item)
+	{
+		UINT32 tail = m_tail;
+		if (tail == m_head)
+		{
+			return false;
+		}
+		SPSC_MEMORY_BARRIER();
+		item = m_items[tail & (Size - 1)];
+		SPSC_MEMORY_BARRIER();
+		m_tail = tail + 1;
+		return true;
+	}
+
+	// Either side; only a snapshot while the other side is running.
+	UINT32 GetCount() { return m_head - m_tail; }
+	UINT32 GetDroppedCount() { return m_dropped; }
+
+private:
+	typedef char SizeMustBeAPowerOfTwo[(Size & (Size - 1)) == 0 ? 1 : -1];
+
+	volatile UINT32 m_head;
+	T m_items[Size];
+	volatile UINT32 m_tail;
+	UINT32 m_dropped;
+};
+
+#endif
@@ -0,0 +1,23 @@
+#include "Subsystem.h"
+
+Subsystem::Subsystem(const char *name, double budget):
+	m_name(name),
+	m_budget(budget)
+{
+}
+
+Subsystem::~Subsystem()
+{
+}
+
+void Subsystem::ReadInputs(InputSnapshot &inputs)
+{
+}
+
+void Subsystem::Start(const InputSnapshot &inputs)
+{
+}
+
+void Subsystem::Stop()
+{
+}
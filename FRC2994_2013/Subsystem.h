@@ -0,0 +1,37 @@
+#ifndef SUBSYSTEM_H_
+#define SUBSYSTEM_H_
+
+#include "WPILib.h"
+#include "InputSnapshot.h"
+
+// One part of the robot (drive, arm, shooter, pneumatics) with the logic
+// that runs it, behind the interface the loops step it through. Each one
+// is run from the teleop RateScheduler as a profiler stage of its own, with
+// its own budget, so its time and overruns show up separately in the
+// profiler dump.
+
+// The loop calls ReadInputs when it reads the sensors (not when it replays
+// a log), Start once at the start of a mode with its first sample, Update
+// at the subsystem's rate with the current sample and Stop to turn
+// everything off.
+
+class Subsystem
+{
+public:
+	// Budget in seconds for one Update.
+	Subsystem(const char *name, double budget);
+	virtual ~Subsystem();
+
+	virtual void ReadInputs(InputSnapshot &inputs);
+	virtual void Start(const InputSnapshot &inputs);
+	virtual void Update(const InputSnapshot &inputs) = 0;
+	virtual void Stop();
+
+	const char *GetName() { return m_name; }
+	double GetBudget() { return m_budget; }
+
+private:
+	const char *m_name;
+	double m_budget;
+};
+#endif
@@ -0,0 +1,94 @@
+#include "TelemetryTask.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+TelemetryTask::TelemetryTask(double period, INT32 priority):
+	m_task("Telemetry", (FUNCPTR)TaskMain, priority),
+	m_period(period),
+	m_lcd(DriverStationLCD::GetInstance()),
+	m_sent(0)
+{
+}
+
+TelemetryTask::~TelemetryTask()
+{
+	m_task.Stop();
+}
+
+bool TelemetryTask::Start()
+{
+	return m_task.Start((size_t)this);
+}
+
+int TelemetryTask::TaskMain(TelemetryTask *telemetry)
+{
+	while (true)
+	{
+		telemetry->Drain();
+		Wait(telemetry->m_period);
+	}
+	return 0;
+}
+
+void TelemetryTask::Drain()
+{
+	TelemetryRecord record;
+	while (m_ring.Pop(record))
+	{
+		switch (record.type)
+		{
+		case kTelemetryNumber:
+			SmartDashboard::PutNumber(record.key, record.value);
+			break;
+		case kTelemetryBoolean:
+			SmartDashboard::PutBoolean(record.key, record.value != 0.0);
+			break;
+		case kTelemetryLCDLine:
+			m_lcd->PrintfLine(record.line, "%s", record.text);
+			break;
+		case kTelemetryLCDUpdate:
+			m_lcd->UpdateLCD();
+			break;
+		}
+		m_sent++;
+	}
+}
+
+bool TelemetryTask::PutNumber(const char *key, double value)
+{
+	TelemetryRecord record;
+	record.type = kTelemetryNumber;
+	record.key = key;
+	record.value = value;
+	return m_ring.Push(record);
+}
+
+bool TelemetryTask::PutBoolean(const char *key, bool value)
+{
+	TelemetryRecord record;
+	record.type = kTelemetryBoolean;
+	record.key = key;
+	record.value = value ? 1.0 : 0.0;
+	return m_ring.Push(record);
+}
+
+bool TelemetryTask::PrintfLine(DriverStationLCD::Line line, const char *format, ...)
+{
+	TelemetryRecord record;
+	record.type = kTelemetryLCDLine;
+	record.line = line;
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(record.text, sizeof(record.text), format, args);
+	va_end(args);
+
+	return m_ring.Push(record);
+}
+
+bool TelemetryTask::UpdateLCD()
+{
+	TelemetryRecord record;
+	record.type = kTelemetryLCDUpdate;
+	return m_ring.Push(record);
+}
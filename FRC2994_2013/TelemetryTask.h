@@ -0,0 +1,62 @@
+#ifndef TELEMETRYTASK_H_
+#define TELEMETRYTASK_H_
+
+#include "WPILib.h"
+#include "SpscRing.h"
+
+// Moves SmartDashboard and driver station LCD output out of the control
+// loop. The loop queues fixed-size records with the Put/Printf calls below,
+// which only copy into a lock-free ring and never block; a separate,
+// lower-priority task drains the ring every period and makes the real
+// (possibly slow) SmartDashboard and DriverStationLCD calls. When the ring
+// is full the record is dropped and counted.
+
+// The Put/Printf/Update calls must all come from the same task (the robot
+// main task).
+
+#define TELEMETRY_RING_SIZE 128
+
+typedef enum
+{
+	kTelemetryNumber, kTelemetryBoolean, kTelemetryLCDLine, kTelemetryLCDUpdate
+} TelemetryType;
+
+typedef struct
+{
+	TelemetryType type;
+	// Dashboard key. Not copied, so it has to outlive the record (a string
+	// literal or a DashboardPublisher key name).
+	const char *key;
+	double value;
+	DriverStationLCD::Line line;
+	char text[DriverStationLCD::kLineLength + 1];
+} TelemetryRecord;
+
+class TelemetryTask
+{
+public:
+	TelemetryTask(double period, INT32 priority);
+	~TelemetryTask();
+
+	bool Start();
+
+	// Producer side. Each returns false if the record was dropped.
+	bool PutNumber(const char *key, double value);
+	bool PutBoolean(const char *key, bool value);
+	bool PrintfLine(DriverStationLCD::Line line, const char *format, ...);
+	bool UpdateLCD();
+
+	UINT32 GetDroppedCount() { return m_ring.GetDroppedCount(); }
+	UINT32 GetSentCount() { return m_sent; }
+
+private:
+	static int TaskMain(TelemetryTask *telemetry);
+	void Drain();
+
+	SpscRing<TelemetryRecord, TELEMETRY_RING_SIZE> m_ring;
+	Task m_task;
+	double m_period;
+	DriverStationLCD *m_lcd;
+	UINT32 m_sent;
+};
+#endif
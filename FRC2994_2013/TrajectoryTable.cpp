@@ -0,0 +1,73 @@
+#include "TrajectoryTable.h"
+#include "TrapezoidProfile.h"
+
+TrajectoryTable::TrajectoryTable():
+	m_numPoints(0),
+	m_numSegments(0),
+	m_rate(1.0)
+{
+}
+
+TrajectoryTable::~TrajectoryTable()
+{
+}
+
+bool TrajectoryTable::Generate(const step_speed *steps, UINT32 numSteps, double period)
+{
+	m_numPoints = 0;
+	m_numSegments = 0;
+	m_rate = 1.0 / period;
+
+	if (numSteps > TRAJECTORY_MAX_SEGMENTS)
+	{
+		return false;
+	}
+
+	TrapezoidProfile profile;
+	for (UINT32 step = 0; step < numSteps; step++)
+	{
+		TrajectorySegment &segment = m_segments[step];
+		segment.first = m_numPoints;
+		segment.count = 0;
+		segment.distance = 0.0f;
+		segment.duration = 0.0f;
+
+		if (0.0 != steps[step].curve)
+		{
+			continue;
+		}
+
+		// The magnitude's sign gives the direction of the move.
+		double distance = (steps[step].magnitude < 0.0) ? -steps[step].distance : steps[step].distance;
+		profile.Configure(distance, steps[step].magnitude * DRIVE_MAX_VELOCITY, DRIVE_MAX_ACCELERATION);
+
+		// One point per period up to and including the end of the move.
+		UINT32 count = (UINT32)(profile.GetDuration() * m_rate) + 2;
+		if (m_numPoints + count > TRAJECTORY_MAX_POINTS)
+		{
+			m_numPoints = 0;
+			m_numSegments = 0;
+			return false;
+		}
+
+		for (UINT32 i = 0; i < count; i++)
+		{
+			double position;
+			double velocity;
+			double acceleration;
+			profile.Sample(i * period, position, velocity, acceleration);
+
+			TrajectoryPoint &point = m_points[m_numPoints + i];
+			point.position = (float)position;
+			point.velocity = (float)velocity;
+			point.acceleration = (float)acceleration;
+		}
+
+		segment.count = count;
+		segment.distance = (float)profile.GetDistance();
+		segment.duration = (float)profile.GetDuration();
+		m_numPoints += count;
+	}
+	m_numSegments = numSteps;
+	return true;
+}
@@ -0,0 +1,90 @@
+#ifndef TRAJECTORYTABLE_H_
+#define TRAJECTORYTABLE_H_
+
+#include "WPILib.h"
+#include "BasicDefines.h"
+
+// Autonomous drive trajectories worked out once, at startup, into a flat
+// array of setpoints (position, velocity and acceleration along the path)
+// spaced one loop period apart. Each straight step of a step table becomes
+// one segment of the array; following a segment in the loop is then just an
+// index and a linear interpolation between two neighbouring points, with
+// none of the profile math left in the hot path.
+
+// The profile of each step is a TrapezoidProfile with the step's magnitude
+// scaling DRIVE_MAX_VELOCITY. Curved steps are left out (their segments are
+// empty) and are driven open loop.
+
+#define TRAJECTORY_MAX_POINTS 2048
+#define TRAJECTORY_MAX_SEGMENTS 8
+
+typedef struct
+{
+	float position;
+	float velocity;
+	float acceleration;
+} TrajectoryPoint;
+
+typedef struct
+{
+	UINT32 first;
+	UINT32 count;
+	float distance;
+	float duration;
+} TrajectorySegment;
+
+class TrajectoryTable
+{
+public:
+	TrajectoryTable();
+	~TrajectoryTable();
+
+	// Period in seconds. Returns false if the steps do not fit, in which
+	// case the table is left empty.
+	bool Generate(const step_speed *steps, UINT32 numSteps, double period);
+
+	UINT32 GetNumSegments() const { return m_numSegments; }
+	UINT32 GetNumPoints() const { return m_numPoints; }
+	bool HasSegment(UINT32 segment) const
+	{
+		return segment < m_numSegments && m_segments[segment].count > 0;
+	}
+	double GetDistance(UINT32 segment) const { return m_segments[segment].distance; }
+	double GetDuration(UINT32 segment) const { return m_segments[segment].duration; }
+
+	// Setpoint the given time (seconds) into a segment; holds at the last
+	// point once the segment is over.
+	void Sample(UINT32 segment, double time, double &position, double &velocity,
+			double &acceleration) const
+	{
+		const TrajectorySegment &s = m_segments[segment];
+		double index = time * m_rate;
+		if (index <= 0.0)
+		{
+			index = 0.0;
+		}
+		UINT32 i = (UINT32)index;
+		if (i + 1 >= s.count)
+		{
+			const TrajectoryPoint &last = m_points[s.first + s.count - 1];
+			position = last.position;
+			velocity = last.velocity;
+			acceleration = last.acceleration;
+			return;
+		}
+		const TrajectoryPoint &a = m_points[s.first + i];
+		const TrajectoryPoint &b = m_points[s.first + i + 1];
+		double fraction = index - i;
+		position = a.position + fraction * (b.position - a.position);
+		velocity = a.velocity + fraction * (b.velocity - a.velocity);
+		acceleration = a.acceleration;
+	}
+
+private:
+	TrajectoryPoint m_points[TRAJECTORY_MAX_POINTS];
+	TrajectorySegment m_segments[TRAJECTORY_MAX_SEGMENTS];
+	UINT32 m_numPoints;
+	UINT32 m_numSegments;
+	double m_rate;
+};
+#endif
@@ -0,0 +1,80 @@
+#include "TrapezoidProfile.h"
+#include <math.h>
+
+TrapezoidProfile::TrapezoidProfile()
+{
+	Configure(0.0, 1.0, 1.0);
+}
+
+TrapezoidProfile::~TrapezoidProfile()
+{
+}
+
+void TrapezoidProfile::Configure(double distance, double maxVelocity, double acceleration)
+{
+	m_sign = (distance < 0.0) ? -1.0 : 1.0;
+	m_distance = fabs(distance);
+	m_velocity = fabs(maxVelocity);
+	m_acceleration = fabs(acceleration);
+
+	if (m_velocity <= 0.0 || m_acceleration <= 0.0)
+	{
+		m_distance = 0.0;
+		m_accelTime = 0.0;
+		m_accelDistance = 0.0;
+		m_cruiseTime = 0.0;
+		m_duration = 0.0;
+		return;
+	}
+
+	// Short moves never reach the cruise velocity: accelerate for half the
+	// distance and decelerate for the other half.
+	if (m_distance < m_velocity * m_velocity / m_acceleration)
+	{
+		m_velocity = sqrt(m_distance * m_acceleration);
+	}
+
+	m_accelTime = m_velocity / m_acceleration;
+	m_accelDistance = 0.5 * m_velocity * m_accelTime;
+	m_cruiseTime = (m_distance - 2.0 * m_accelDistance) / m_velocity;
+	m_duration = 2.0 * m_accelTime + m_cruiseTime;
+}
+
+void TrapezoidProfile::Sample(double time, double &position, double &velocity, double &acceleration)
+{
+	if (time <= 0.0)
+	{
+		position = 0.0;
+		velocity = 0.0;
+		acceleration = 0.0;
+	}
+	else if (time < m_accelTime)
+	{
+		position = 0.5 * m_acceleration * time * time;
+		velocity = m_acceleration * time;
+		acceleration = m_acceleration;
+	}
+	else if (time < m_accelTime + m_cruiseTime)
+	{
+		position = m_accelDistance + m_velocity * (time - m_accelTime);
+		velocity = m_velocity;
+		acceleration = 0.0;
+	}
+	else if (time < m_duration)
+	{
+		double remaining = m_duration - time;
+		position = m_distance - 0.5 * m_acceleration * remaining * remaining;
+		velocity = m_acceleration * remaining;
+		acceleration = -m_acceleration;
+	}
+	else
+	{
+		position = m_distance;
+		velocity = 0.0;
+		acceleration = 0.0;
+	}
+
+	position *= m_sign;
+	velocity *= m_sign;
+	acceleration *= m_sign;
+}
@@ -0,0 +1,37 @@
+#ifndef TRAPEZOIDPROFILE_H_
+#define TRAPEZOIDPROFILE_H_
+
+// Move of a given distance that accelerates at a constant rate up to a
+// cruise velocity, cruises, and decelerates at the same rate to a stop. A
+// move too short to reach the cruise velocity becomes a triangle.
+
+// Distances and velocities are in whatever units the caller uses (inches
+// and inches per second for the drive); times are in seconds. A negative
+// distance gives the same profile backwards.
+
+class TrapezoidProfile
+{
+public:
+	TrapezoidProfile();
+	~TrapezoidProfile();
+
+	void Configure(double distance, double maxVelocity, double acceleration);
+
+	// Setpoint the given time after the start; holds at the end point once
+	// the move is over.
+	void Sample(double time, double &position, double &velocity, double &acceleration);
+
+	double GetDistance() { return m_sign * m_distance; }
+	double GetDuration() { return m_duration; }
+
+private:
+	double m_distance;
+	double m_sign;
+	double m_velocity;
+	double m_acceleration;
+	double m_accelTime;
+	double m_accelDistance;
+	double m_cruiseTime;
+	double m_duration;
+};
+#endif
@@ -0,0 +1,180 @@
+#include "WPILib.h"
+#include "SimHardware.h"
+#include "SimPlant.h"
+#include "BasicDefines.h"
+#include "InputLog.h"
+#include "RobotProfiles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Host entry point: runs one simulated match against the RobotDemo built
+// from FRC2994_2013 and reports what each pass through the robot loops cost.
+
+// The drive wiring of a profile, for the plant
+template <class Profile>
+static SimDriveWiring DriveWiring()
+{
+	SimDriveWiring wiring;
+	wiring.invertLeftDrive = Profile::kInvertLeftDrive;
+	wiring.reverseLeftEncoder = Profile::kReverseLeftEncoder;
+	wiring.reverseRightEncoder = Profile::kReverseRightEncoder;
+	return wiring;
+}
+
+// Wire the plant like the named robot; false if there is no such profile.
+static bool WirePlant(const char *profile)
+{
+	if (0 == strcmp(profile, PlyboyProfile::Name()))
+	{
+		SimPlant::SetDriveWiring(DriveWiring<PlyboyProfile>());
+	}
+	else if (0 == strcmp(profile, WhamO1Profile::Name()))
+	{
+		SimPlant::SetDriveWiring(DriveWiring<WhamO1Profile>());
+	}
+	else if (0 == strcmp(profile, WhamO2Profile::Name()))
+	{
+		SimPlant::SetDriveWiring(DriveWiring<WhamO2Profile>());
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+static void Usage(const char *program)
+{
+	fprintf(stderr,
+		"usage: %s [--robot NAME] [--realtime] [--auto SECONDS] [--teleop SECONDS] [--lcd]\n"
+		"          [--replay FILE]\n"
+		"  --robot NAME      robot profile to run: %s, %s or %s (default %s)\n"
+		"  --realtime        run at wall-clock speed instead of accelerated\n"
+		"  --auto SECONDS    length of the autonomous period (default 15)\n"
+		"  --teleop SECONDS  length of the teleop period (default 135)\n"
+		"  --lcd             print the driver station LCD at the end\n"
+		"  --replay FILE     drive teleop from a recorded input log (the length\n"
+		"                    of teleop comes from the log)\n",
+		program, PlyboyProfile::Name(), WhamO1Profile::Name(), WhamO2Profile::Name(),
+		ROBOT_PROFILE::Name());
+}
+
+static void PrintLoop(const char *name, const SimLoopStats &loop)
+{
+	if (0 == loop.iterations)
+	{
+		printf("  %-11s no iterations\n", name);
+		return;
+	}
+	printf("  %-11s %8u iterations, mean %8.2f us, max %8.2f us\n", name,
+		loop.iterations,
+		1e6 * loop.busyTotal / loop.iterations,
+		1e6 * loop.busyMax);
+}
+
+int main(int argc, char **argv)
+{
+	SimMatchTiming timing;
+	timing.disabledTime = 0.5;
+	timing.autonomousTime = 15.0;
+	timing.teleopTime = 135.0;
+	bool realTime = false;
+	bool showLCD = false;
+	const char *replayFile = NULL;
+	const char *profile = ROBOT_PROFILE::Name();
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == strcmp(argv[i], "--robot") && i + 1 < argc)
+		{
+			profile = argv[++i];
+		}
+		else if (0 == strcmp(argv[i], "--realtime"))
+		{
+			realTime = true;
+		}
+		else if (0 == strcmp(argv[i], "--auto") && i + 1 < argc)
+		{
+			timing.autonomousTime = atof(argv[++i]);
+		}
+		else if (0 == strcmp(argv[i], "--teleop") && i + 1 < argc)
+		{
+			timing.teleopTime = atof(argv[++i]);
+		}
+		else if (0 == strcmp(argv[i], "--lcd"))
+		{
+			showLCD = true;
+		}
+		else if (0 == strcmp(argv[i], "--replay") && i + 1 < argc)
+		{
+			replayFile = argv[++i];
+		}
+		else
+		{
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+
+	// A replay takes over the controls for as long as the recording lasts
+	if (NULL != replayFile)
+	{
+		InputLog *log = new InputLog();
+		if (!log->Load(replayFile))
+		{
+			fprintf(stderr, "%s: cannot load input log %s\n", argv[0], replayFile);
+			delete log;
+			return 1;
+		}
+		timing.teleopTime = log->GetDuration() + TELEOP_LOOP_PERIOD;
+		delete log;
+		InputLog::SetReplayFile(replayFile);
+		SimPlant::SetDriveTeam(false);
+	}
+
+	Sim::SetRealTime(realTime);
+	SimPlant::Initialize(timing);
+	if (!WirePlant(profile))
+	{
+		Usage(argv[0]);
+		return 1;
+	}
+	Sim::SetStepHook(SimPlant::Step);
+
+	RobotBase *robot = CreateRobot(profile);
+	if (NULL == robot)
+	{
+		Usage(argv[0]);
+		return 1;
+	}
+	double wallStart = Sim::WallClock();
+	robot->StartCompetition();
+	double wallElapsed = Sim::WallClock() - wallStart;
+
+	const SimStats &stats = Sim::Stats();
+	printf("%s host simulation (%s): %.1f s simulated in %.3f s\n", profile,
+		realTime ? "real-time" : "accelerated", Sim::Now(), wallElapsed);
+	PrintLoop("autonomous", stats.loop[kSimAutonomous]);
+	PrintLoop("teleop", stats.loop[kSimOperatorControl]);
+	printf("  dashboard   %8u puts, %u bytes (%.0f bytes/s)\n",
+		stats.dashboardPuts, stats.dashboardBytes,
+		stats.dashboardBytes / (timing.autonomousTime + timing.teleopTime));
+	printf("  lcd         %8u formats, %u updates\n", stats.lcdFormats, stats.lcdUpdates);
+	printf("  pressure    %8.1f psi at end of match\n", SimPlant::Pressure());
+	printf("  outputs     teleop hash %08x%s\n", SimPlant::OutputHash(),
+		NULL != replayFile ? " (replayed)" : "");
+
+	if (showLCD)
+	{
+		DriverStationLCD *lcd = DriverStationLCD::GetInstance();
+		for (int line = DriverStationLCD::kUser_Line1; line <= DriverStationLCD::kUser_Line6; line++)
+		{
+			printf("  [%s]\n", lcd->GetSentLine((DriverStationLCD::Line)line));
+		}
+	}
+
+	delete robot;
+	return 0;
+}
@@ -0,0 +1,393 @@
+#include "SimPlant.h"
+#include "SimHardware.h"
+#include "BasicDefines.h"
+
+#include <math.h>
+#include <string.h>
+
+// Driver station ports, as wired in RobotDemo's constructor.
+#define SIM_STICK_PORT   1
+#define SIM_STICK2_PORT  2
+#define SIM_GAMEPAD_PORT 3
+
+// Gamepad axes (see Gamepad.h).
+#define SIM_GAMEPAD_LEFT_Y 2
+#define SIM_GAMEPAD_DPAD_X 5
+#define SIM_GAMEPAD_DPAD_Y 6
+
+// Drive train: top speed of the wheels and the first-order lag of the
+// motors and robot mass behind them.
+#define SIM_DRIVE_MAX_SPEED   120.0   // inches per second
+#define SIM_DRIVE_TIME_CONST  0.15    // seconds
+
+// Arm: rate at which the rotation pot moves at full motor output, and the
+// motor output it takes to hold the arm up when it is level.
+#define SIM_ARM_VOLTS_PER_SEC 1.5
+// Gravity is taken to resist the climb (pull toward higher pot volts), as
+// the original ARM_CLIMB and ARM_DESCEND settings suggest; the level point
+// and the angle per volt are guesses of the plant's own, not ArmController's,
+// so the sim does not simply agree with the robot code's feed-forward.
+#define SIM_ARM_GRAVITY       0.1
+#define SIM_ARM_LEVEL_VOLTS   3.0
+#define SIM_ARM_RADIANS_PER_VOLT 0.8
+#define SIM_ARM_MIN_VOLTS     0.2
+#define SIM_ARM_MAX_VOLTS     4.8
+
+// Arm pot noise: a uniform jitter on every reading, and a single-reading
+// spike every so often, like a dirty wiper.
+#define SIM_POT_NOISE         0.02
+#define SIM_POT_SPIKE         0.8
+#define SIM_POT_SPIKE_CHANCE  0.01
+
+// Shooter wheel: free speed and spin-up time constant, and the share of
+// its speed a disk takes with it as it is fired.
+#define SIM_SHOOTER_MAX_RPM    6000.0
+#define SIM_SHOOTER_TIME_CONST 0.6
+#define SIM_SHOOTER_SHOT_DROP  0.25
+
+// Indexer cam: revolutions per second at full output, and the part of a
+// revolution during which the (normally closed) indexer switch is open.
+#define SIM_INDEXER_REV_PER_SEC 1.2
+#define SIM_INDEXER_OPEN_WINDOW 0.08
+// Chance, each step, that the indexer switch reads wrong for that step
+// (vibration while the robot drives and the wheel spins).
+#define SIM_INDEXER_GLITCH_CHANCE 0.002
+
+// Pneumatics: compressor fill rate, pressure switch band and the pressure
+// lost for each actuation of a cylinder.
+#define SIM_PRESSURE_START     60.0
+#define SIM_PRESSURE_FILL_RATE 4.0
+#define SIM_PRESSURE_SWITCH_ON  120.0
+#define SIM_PRESSURE_SWITCH_OFF 95.0
+#define SIM_PRESSURE_PER_SHIFT  1.5
+#define SIM_PRESSURE_PER_CLAW   1.0
+
+static SimMatchTiming s_timing;
+static SimDriveWiring s_wiring;
+static double s_leftSpeed;
+static double s_rightSpeed;
+static double s_leftPosition;
+static double s_rightPosition;
+static double s_shooterRPM;
+static double s_shooterRevs;
+static double s_indexerPhase;
+static bool s_indexerOpen;
+static double s_pressure;
+static double s_armVolts;
+static UINT32 s_noiseSeed;
+static bool s_previousSolenoid[SIM_NUM_SOLENOID];
+static bool s_driveTeam = true;
+static UINT32 s_outputHash;
+
+// True while t (wrapped to the given period) lies in [start, start + width).
+static bool InWindow(double t, double period, double start, double width)
+{
+	double phase = fmod(t, period);
+	return phase >= start && phase < start + width;
+}
+
+// Repeatable noise in [-1, 1), so a run can still be replayed exactly.
+static double Noise()
+{
+	s_noiseSeed = s_noiseSeed * 1664525u + 1013904223u;
+	return (s_noiseSeed >> 8) / 8388608.0 - 1.0;
+}
+
+static void SetButton(SimHardware &hw, int port, int button, bool pressed)
+{
+	UINT16 mask = (UINT16)(1 << (button - 1));
+	if (pressed)
+	{
+		hw.stickButtons[port] |= mask;
+	}
+	else
+	{
+		hw.stickButtons[port] &= (UINT16)~mask;
+	}
+}
+
+// Scripted drive team. The pattern repeats, so a long teleop period keeps
+// exercising every control path (including simultaneous claw presses).
+static void DriveTeam(SimHardware &hw, double t)
+{
+	hw.stickAxis[SIM_STICK_PORT][1] = 0.4 * sin(0.9 * t);
+	hw.stickAxis[SIM_STICK_PORT][2] = -0.7 * sin(0.4 * t);
+
+	SetButton(hw, SIM_STICK2_PORT, BUTTON_SHIFT, InWindow(t, 6.0, 3.0, 3.0));
+
+	float leftY = 0.0;
+	if (InWindow(t, 20.0, 10.0, 2.0))
+	{
+		leftY = -0.8;
+	}
+	else if (InWindow(t, 20.0, 14.0, 2.0))
+	{
+		leftY = 0.6;
+	}
+	hw.stickAxis[SIM_GAMEPAD_PORT][SIM_GAMEPAD_LEFT_Y] = leftY;
+
+	float dpadY = 0.0;
+	if (InWindow(t, 20.0, 17.0, 0.2))
+	{
+		dpadY = -1.0;
+	}
+	else if (InWindow(t, 20.0, 18.0, 0.2))
+	{
+		dpadY = 1.0;
+	}
+	hw.stickAxis[SIM_GAMEPAD_PORT][SIM_GAMEPAD_DPAD_X] = 0.0;
+	hw.stickAxis[SIM_GAMEPAD_PORT][SIM_GAMEPAD_DPAD_Y] = dpadY;
+
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_TOGGLE_SHOOTER, InWindow(t, 30.0, 1.0, 0.2));
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_INDEXER, InWindow(t, 5.0, 2.5, 0.2));
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_GREEN_CLAW_LOCKED, InWindow(t, 40.0, 5.0, 0.2));
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_YELLOW_CLAW_LOCKED, InWindow(t, 40.0, 5.1, 0.2));
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_GREEN_CLAW_UNLOCKED, InWindow(t, 40.0, 25.0, 0.2));
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_YELLOW_CLAW_UNLOCKED, InWindow(t, 40.0, 25.1, 0.2));
+	SetButton(hw, SIM_GAMEPAD_PORT, BUTTON_STOP_ALL, InWindow(t, 60.0, 59.0, 0.2));
+}
+
+static void ReleaseControls(SimHardware &hw)
+{
+	memset(hw.stickAxis, 0, sizeof(hw.stickAxis));
+	memset(hw.stickButtons, 0, sizeof(hw.stickButtons));
+}
+
+static void UpdateMatch(SimHardware &hw, double now)
+{
+	double autoStart = s_timing.disabledTime;
+	double autoEnd = autoStart + s_timing.autonomousTime;
+	double teleopStart = SimPlant::TeleopStartTime();
+
+	SimMode mode;
+	if (now < autoStart)
+	{
+		mode = kSimDisabled;
+	}
+	else if (now < autoEnd)
+	{
+		mode = kSimAutonomous;
+	}
+	else if (now < teleopStart)
+	{
+		mode = kSimDisabled;
+	}
+	else if (now < SimPlant::MatchEndTime())
+	{
+		mode = kSimOperatorControl;
+	}
+	else
+	{
+		mode = kSimMatchOver;
+	}
+	Sim::SetMode(mode);
+
+	if (kSimOperatorControl == mode && s_driveTeam)
+	{
+		DriveTeam(hw, now - teleopStart);
+	}
+	else
+	{
+		ReleaseControls(hw);
+	}
+}
+
+// Speeds and positions are of the wheels, forward positive. RobotDrive
+// drives the right side with negative outputs; the left side too if the
+// left motors are mounted backwards.
+static void UpdateDrive(SimHardware &hw, double dt)
+{
+	double alpha = dt / (SIM_DRIVE_TIME_CONST + dt);
+	double leftCommand = 0.5 * (hw.pwm[LEFT_FRONT_DRIVE_PWM] + hw.pwm[LEFT_REAR_DRIVE_PWM]);
+	double rightCommand = -0.5 * (hw.pwm[RIGHT_FRONT_DRIVE_PWM] + hw.pwm[RIGHT_REAR_DRIVE_PWM]);
+	if (s_wiring.invertLeftDrive)
+	{
+		leftCommand = -leftCommand;
+	}
+
+	s_leftSpeed += alpha * (leftCommand * SIM_DRIVE_MAX_SPEED - s_leftSpeed);
+	s_rightSpeed += alpha * (rightCommand * SIM_DRIVE_MAX_SPEED - s_rightSpeed);
+	s_leftPosition += s_leftSpeed * dt;
+	s_rightPosition += s_rightSpeed * dt;
+
+	// A reversed encoder is one that counts down going forward
+	double left = s_wiring.reverseLeftEncoder ? -1.0 : 1.0;
+	double right = s_wiring.reverseRightEncoder ? -1.0 : 1.0;
+	hw.encoderCount[LEFT_DRIVE_ENC_A] = (INT32)(left * s_leftPosition / DRIVE_ENCODER_DISTANCE_PER_PULSE);
+	hw.encoderCount[RIGHT_DRIVE_ENC_A] = (INT32)(right * s_rightPosition / DRIVE_ENCODER_DISTANCE_PER_PULSE);
+	hw.encoderRate[LEFT_DRIVE_ENC_A] = left * s_leftSpeed / DRIVE_ENCODER_DISTANCE_PER_PULSE;
+	hw.encoderRate[RIGHT_DRIVE_ENC_A] = right * s_rightSpeed / DRIVE_ENCODER_DISTANCE_PER_PULSE;
+}
+
+static void UpdateArm(SimHardware &hw, double dt)
+{
+	double gravity = SIM_ARM_GRAVITY * cos((s_armVolts - SIM_ARM_LEVEL_VOLTS) * SIM_ARM_RADIANS_PER_VOLT);
+	s_armVolts += SIM_ARM_VOLTS_PER_SEC * (hw.pwm[ARM_PWM] + gravity) * dt;
+	if (s_armVolts < SIM_ARM_MIN_VOLTS)
+	{
+		s_armVolts = SIM_ARM_MIN_VOLTS;
+	}
+	else if (s_armVolts > SIM_ARM_MAX_VOLTS)
+	{
+		s_armVolts = SIM_ARM_MAX_VOLTS;
+	}
+
+	double reading = s_armVolts + SIM_POT_NOISE * Noise();
+	if (Noise() < SIM_POT_SPIKE_CHANCE * 2.0 - 1.0)
+	{
+		reading += SIM_POT_SPIKE * (Noise() < 0.0 ? -1.0 : 1.0);
+	}
+	hw.analog[ARM_ROTATION_POT] = (float)reading;
+}
+
+static void UpdateShooter(SimHardware &hw, double dt)
+{
+	double alpha = dt / (SIM_SHOOTER_TIME_CONST + dt);
+	s_shooterRPM += alpha * (hw.pwm[SHOOTER_PWM] * SIM_SHOOTER_MAX_RPM - s_shooterRPM);
+
+	s_indexerPhase += SIM_INDEXER_REV_PER_SEC * hw.pwm[INDEX_PWM] * dt;
+	s_indexerPhase -= floor(s_indexerPhase);
+	bool feeding = s_indexerPhase < SIM_INDEXER_OPEN_WINDOW;
+
+	// A disk goes into the wheel as the indexer switch opens.
+	if (feeding && !s_indexerOpen)
+	{
+		s_shooterRPM *= 1.0 - SIM_SHOOTER_SHOT_DROP;
+	}
+	s_indexerOpen = feeding;
+	hw.dio[INDEXER_SW] = feeding;
+	if (Noise() < SIM_INDEXER_GLITCH_CHANCE * 2.0 - 1.0)
+	{
+		hw.dio[INDEXER_SW] = !feeding;
+	}
+
+	// Wheel speed sensor pulses, counted like an encoder.
+	s_shooterRevs += s_shooterRPM / 60.0 * dt;
+	hw.encoderCount[SHOOTER_SPEED_SENSOR] = (INT32)(s_shooterRevs * SHOOTER_PULSES_PER_REV);
+	hw.encoderRate[SHOOTER_SPEED_SENSOR] = s_shooterRPM / 60.0 * SHOOTER_PULSES_PER_REV;
+}
+
+static void UpdatePneumatics(SimHardware &hw, double dt)
+{
+	// Every change of a solenoid valve vents one cylinder volume.
+	for (int i = 1; i < SIM_NUM_SOLENOID; i++)
+	{
+		if (hw.solenoid[i] && !s_previousSolenoid[i])
+		{
+			bool shifter = (SHIFTER_A == i || SHIFTER_B == i);
+			s_pressure -= shifter ? SIM_PRESSURE_PER_SHIFT : SIM_PRESSURE_PER_CLAW;
+		}
+		s_previousSolenoid[i] = hw.solenoid[i];
+	}
+
+	if (hw.relayForward[COMPRESSOR_SPIKE])
+	{
+		s_pressure += SIM_PRESSURE_FILL_RATE * dt;
+	}
+	if (s_pressure < 0.0)
+	{
+		s_pressure = 0.0;
+	}
+
+	if (s_pressure >= SIM_PRESSURE_SWITCH_ON)
+	{
+		hw.dio[COMPRESSOR_PRESSURE_SW] = true;
+	}
+	else if (s_pressure < SIM_PRESSURE_SWITCH_OFF)
+	{
+		hw.dio[COMPRESSOR_PRESSURE_SW] = false;
+	}
+
+	// The claw lock sensors follow the lock valves.
+	hw.dio[GREEN_LOCK_SENSOR] = hw.solenoid[GREEN_CLAW_LOCKED];
+	hw.dio[YELLOW_LOCK_SENSOR] = hw.solenoid[YELLOW_CLAW_LOCKED];
+}
+
+// FNV-1a over the raw bytes of the outputs.
+static void HashBytes(const void *data, size_t size)
+{
+	const UINT8 *bytes = (const UINT8 *)data;
+	for (size_t i = 0; i < size; i++)
+	{
+		s_outputHash = (s_outputHash ^ bytes[i]) * 16777619u;
+	}
+}
+
+static void HashOutputs(const SimHardware &hw)
+{
+	HashBytes(hw.pwm, sizeof(hw.pwm));
+	HashBytes(hw.solenoid, sizeof(hw.solenoid));
+}
+
+void SimPlant::Initialize(const SimMatchTiming &timing)
+{
+	s_timing = timing;
+	s_leftSpeed = 0.0;
+	s_rightSpeed = 0.0;
+	s_leftPosition = 0.0;
+	s_rightPosition = 0.0;
+	s_shooterRPM = 0.0;
+	s_shooterRevs = 0.0;
+	s_indexerPhase = SIM_INDEXER_OPEN_WINDOW / 2;
+	s_pressure = SIM_PRESSURE_START;
+	memset(s_previousSolenoid, 0, sizeof(s_previousSolenoid));
+	s_outputHash = 2166136261u;
+
+	SimHardware &hw = Sim::Hardware();
+	s_armVolts = 2.5;
+	s_noiseSeed = 12345u;
+	hw.analog[ARM_ROTATION_POT] = (float)s_armVolts;
+	s_indexerOpen = true;
+	hw.dio[INDEXER_SW] = true;
+	Sim::SetMode(kSimDisabled);
+}
+
+void SimPlant::SetDriveWiring(const SimDriveWiring &wiring)
+{
+	s_wiring = wiring;
+}
+
+void SimPlant::Step(double now, double dt)
+{
+	SimHardware &hw = Sim::Hardware();
+
+	UpdateDrive(hw, dt);
+	UpdateArm(hw, dt);
+	UpdateShooter(hw, dt);
+	UpdatePneumatics(hw, dt);
+	if (kSimOperatorControl == hw.mode)
+	{
+		HashOutputs(hw);
+	}
+	UpdateMatch(hw, now);
+}
+
+double SimPlant::TeleopStartTime()
+{
+	return 2 * s_timing.disabledTime + s_timing.autonomousTime;
+}
+
+double SimPlant::MatchEndTime()
+{
+	return TeleopStartTime() + s_timing.teleopTime;
+}
+
+double SimPlant::Pressure()
+{
+	return s_pressure;
+}
+
+double SimPlant::ShooterRPM()
+{
+	return s_shooterRPM;
+}
+
+void SimPlant::SetDriveTeam(bool enabled)
+{
+	s_driveTeam = enabled;
+}
+
+UINT32 SimPlant::OutputHash()
+{
+	return s_outputHash;
+}
@@ -0,0 +1,50 @@
+#ifndef SIMPLANT_H_
+#define SIMPLANT_H_
+
+#include "Base.h"
+
+// Plant model and scripted drive team for the host simulation. On every
+// simulated time step it advances the match (disabled, autonomous,
+// disabled, teleop), moves the inputs the way a driver would, and turns
+// the robot's motor and solenoid outputs back into sensor readings.
+
+typedef struct
+{
+	double disabledTime;
+	double autonomousTime;
+	double teleopTime;
+} SimMatchTiming;
+
+// How the robot being simulated has its drive wired (see RobotProfiles.h).
+// The plant turns the drive outputs into wheel motion, and the wheel motion
+// into encoder counts, to match.
+typedef struct
+{
+	bool invertLeftDrive;
+	bool reverseLeftEncoder;
+	bool reverseRightEncoder;
+} SimDriveWiring;
+
+class SimPlant
+{
+public:
+	static void Initialize(const SimMatchTiming &timing);
+	static void SetDriveWiring(const SimDriveWiring &wiring);
+	static void Step(double now, double dt);
+
+	static double TeleopStartTime();
+	static double MatchEndTime();
+
+	// Air pressure in the storage tanks (psi).
+	static double Pressure();
+	static double ShooterRPM();
+
+	// Whether the scripted drive team works the controls in teleop (off
+	// when replaying a recorded match).
+	static void SetDriveTeam(bool enabled);
+	// Hash of every motor and solenoid output seen in teleop, for telling
+	// whether two runs drove the robot the same way.
+	static UINT32 OutputHash();
+};
+
+#endif
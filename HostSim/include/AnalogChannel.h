@@ -0,0 +1,24 @@
+#ifndef ANALOGCHANNEL_H_
+#define ANALOGCHANNEL_H_
+
+#include "Base.h"
+
+class AnalogChannel
+{
+public:
+	explicit AnalogChannel(UINT32 channel);
+	AnalogChannel(UINT8 moduleNumber, UINT32 channel);
+	virtual ~AnalogChannel();
+
+	INT16 GetValue();
+	INT32 GetAverageValue();
+	float GetVoltage();
+	float GetAverageVoltage();
+	UINT32 GetChannel() { return m_channel; }
+
+private:
+	UINT32 m_channel;
+	DISALLOW_COPY_AND_ASSIGN(AnalogChannel);
+};
+
+#endif
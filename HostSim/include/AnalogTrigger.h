@@ -0,0 +1,33 @@
+#ifndef ANALOGTRIGGER_H_
+#define ANALOGTRIGGER_H_
+
+#include "Base.h"
+
+class AnalogChannel;
+
+// Windowed trigger on an analog channel. As on the FPGA, the trigger state
+// goes true above the upper limit, false below the lower limit and holds
+// its previous value in between.
+class AnalogTrigger
+{
+public:
+	explicit AnalogTrigger(UINT32 channel);
+	AnalogTrigger(UINT8 moduleNumber, UINT32 channel);
+	explicit AnalogTrigger(AnalogChannel *channel);
+	virtual ~AnalogTrigger();
+
+	void SetLimitsVoltage(float lower, float upper);
+	void SetAveraged(bool useAveragedValue);
+	void SetFiltered(bool useFilteredValue);
+	bool GetInWindow();
+	bool GetTriggerState();
+
+private:
+	UINT32 m_channel;
+	float m_lower;
+	float m_upper;
+	bool m_state;
+	DISALLOW_COPY_AND_ASSIGN(AnalogTrigger);
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef BASE_H_
+#define BASE_H_
+
+// Host stand-in for the vxWorks/WPILib base types. Only what the robot
+// code actually uses is provided.
+
+#include <stddef.h>
+
+typedef signed char        INT8;
+typedef unsigned char      UINT8;
+typedef short              INT16;
+typedef unsigned short     UINT16;
+typedef int                INT32;
+typedef unsigned int       UINT32;
+typedef long long          INT64;
+typedef unsigned long long UINT64;
+
+typedef int STATUS;
+typedef int (*FUNCPTR)(...);
+
+#ifndef OK
+#define OK 0
+#endif
+#ifndef ERROR
+#define ERROR (-1)
+#endif
+
+#define DISALLOW_COPY_AND_ASSIGN(TypeName) \
+	TypeName(const TypeName&);             \
+	void operator=(const TypeName&)
+
+#endif
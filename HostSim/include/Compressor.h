@@ -0,0 +1,27 @@
+#ifndef COMPRESSOR_H_
+#define COMPRESSOR_H_
+
+#include "Base.h"
+
+// The real class runs its own task that switches the relay from the
+// pressure switch; the simulator does the same on every time step.
+class Compressor
+{
+public:
+	Compressor(UINT32 pressureSwitchChannel, UINT32 compressorRelayChannel);
+	Compressor(UINT8 pressureSwitchModuleNumber, UINT32 pressureSwitchChannel,
+			UINT8 compresssorRelayModuleNumber, UINT32 compressorRelayChannel);
+	~Compressor();
+
+	void Start();
+	void Stop();
+	bool Enabled();
+	UINT32 GetPressureSwitchValue();
+
+private:
+	UINT32 m_pressureSwitchChannel;
+	UINT32 m_relayChannel;
+	DISALLOW_COPY_AND_ASSIGN(Compressor);
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef COUNTER_H_
+#define COUNTER_H_
+
+#include "Base.h"
+
+// Up counter on a digital input. Like the encoders, the simulated count and
+// pulse rate live in SimHardware under the input channel.
+class Counter
+{
+public:
+	explicit Counter(UINT32 channel);
+	Counter(UINT8 moduleNumber, UINT32 channel);
+	virtual ~Counter();
+
+	void Start();
+	INT32 Get();
+	void Reset();
+	void Stop();
+	// Seconds between the last two pulses; infinite once the input has been
+	// quiet for longer than the max period, as on the FPGA.
+	double GetPeriod();
+	void SetMaxPeriod(double maxPeriod);
+	bool GetStopped();
+
+private:
+	UINT32 m_channel;
+	bool m_running;
+	INT32 m_offset;
+	INT32 m_stoppedCount;
+	double m_maxPeriod;
+	DISALLOW_COPY_AND_ASSIGN(Counter);
+};
+
+#endif
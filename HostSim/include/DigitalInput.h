@@ -0,0 +1,33 @@
+#ifndef DIGITALINPUT_H_
+#define DIGITALINPUT_H_
+
+#include "Base.h"
+
+// Called on an edge, from the interrupt task on the robot and from
+// Sim::Advance here.
+typedef void (*tInterruptHandler)(UINT32 interruptAssertedMask, void *param);
+
+class DigitalInput
+{
+public:
+	explicit DigitalInput(UINT32 channel);
+	DigitalInput(UINT8 moduleNumber, UINT32 channel);
+	virtual ~DigitalInput();
+
+	UINT32 Get();
+	UINT32 GetChannel();
+
+	// Asynchronous interrupts only (no WaitForInterrupt).
+	void RequestInterrupts(tInterruptHandler handler, void *param = NULL);
+	void CancelInterrupts();
+	void SetUpSourceEdge(bool risingEdge, bool fallingEdge);
+	void EnableInterrupts();
+	void DisableInterrupts();
+	double ReadInterruptTimestamp();
+
+private:
+	UINT32 m_channel;
+	DISALLOW_COPY_AND_ASSIGN(DigitalInput);
+};
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef DOUBLESOLENOID_H_
+#define DOUBLESOLENOID_H_
+
+#include "Base.h"
+
+class DoubleSolenoid
+{
+public:
+	typedef enum {kOff, kForward, kReverse} Value;
+
+	DoubleSolenoid(UINT32 forwardChannel, UINT32 reverseChannel);
+	DoubleSolenoid(UINT8 moduleNumber, UINT32 forwardChannel, UINT32 reverseChannel);
+	virtual ~DoubleSolenoid();
+
+	virtual void Set(Value value);
+	virtual Value Get();
+
+private:
+	UINT32 m_forwardChannel;
+	UINT32 m_reverseChannel;
+	DISALLOW_COPY_AND_ASSIGN(DoubleSolenoid);
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef DRIVERSTATION_H_
+#define DRIVERSTATION_H_
+
+#include "Base.h"
+
+// Simulated driver station. Stick values and the match mode come from the
+// harness through SimHardware.
+class DriverStation
+{
+public:
+	static const UINT32 kJoystickPorts = 4;
+	static const UINT32 kJoystickAxes = 6;
+
+	static DriverStation *GetInstance();
+
+	float GetStickAxis(UINT32 stick, UINT32 axis);
+	short GetStickButtons(UINT32 stick);
+
+	bool IsEnabled();
+	bool IsDisabled();
+	bool IsAutonomous();
+	bool IsOperatorControl();
+	bool IsTest();
+	bool IsNewControlData();
+	float GetBatteryVoltage();
+
+private:
+	DriverStation();
+	DISALLOW_COPY_AND_ASSIGN(DriverStation);
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef DRIVERSTATIONLCD_H_
+#define DRIVERSTATIONLCD_H_
+
+#include "Base.h"
+#include <stdarg.h>
+
+class DriverStationLCD
+{
+public:
+	static const INT32 kLineLength = 21;
+	static const INT32 kNumLines = 6;
+	enum Line {kMain_Line6=0, kUser_Line1=0, kUser_Line2=1, kUser_Line3=2, kUser_Line4=3, kUser_Line5=4, kUser_Line6=5};
+
+	static DriverStationLCD *GetInstance();
+
+	void UpdateLCD();
+	void Printf(Line line, INT32 startingColumn, const char *writeFmt, ...);
+	void VPrintf(Line line, INT32 startingColumn, const char *writeFmt, va_list args);
+	void PrintfLine(Line line, const char *writeFmt, ...);
+	void VPrintfLine(Line line, const char *writeFmt, va_list args);
+	void Clear();
+
+	// Host-only: the text most recently sent with UpdateLCD().
+	const char *GetSentLine(Line line);
+
+private:
+	DriverStationLCD();
+
+	char m_textBuffer[kNumLines][kLineLength];
+	char m_sentBuffer[kNumLines][kLineLength + 1];
+	DISALLOW_COPY_AND_ASSIGN(DriverStationLCD);
+};
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef ENCODER_H_
+#define ENCODER_H_
+
+#include "Base.h"
+
+// Quadrature encoder. The simulated count lives in SimHardware under the
+// encoder's A channel and is always reported at 4X resolution.
+class Encoder
+{
+public:
+	typedef enum {k1X, k2X, k4X} EncodingType;
+
+	Encoder(UINT32 aChannel, UINT32 bChannel, bool reverseDirection = false, EncodingType encodingType = k4X);
+	Encoder(UINT8 aModuleNumber, UINT32 aChannel, UINT8 bModuleNumber, UINT32 bChannel,
+			bool reverseDirection = false, EncodingType encodingType = k4X);
+	virtual ~Encoder();
+
+	void Start();
+	INT32 Get();
+	INT32 GetRaw();
+	void Reset();
+	void Stop();
+	double GetPeriod();
+	void SetMaxPeriod(double maxPeriod);
+	bool GetStopped();
+	bool GetDirection();
+	double GetDistance();
+	double GetRate();
+	void SetMinRate(double minRate);
+	void SetDistancePerPulse(double distancePerPulse);
+	void SetReverseDirection(bool reverseDirection);
+
+private:
+	INT32 HardwareCount();
+
+	UINT32 m_aChannel;
+	bool m_reverseDirection;
+	bool m_running;
+	INT32 m_offset;
+	INT32 m_stoppedCount;
+	double m_distancePerPulse;
+	double m_maxPeriod;
+	DISALLOW_COPY_AND_ASSIGN(Encoder);
+};
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef JOYSTICK_H_
+#define JOYSTICK_H_
+
+#include "GenericHID.h"
+
+class DriverStation;
+
+class Joystick : public GenericHID
+{
+public:
+	static const UINT32 kDefaultXAxis = 1;
+	static const UINT32 kDefaultYAxis = 2;
+	static const UINT32 kDefaultZAxis = 3;
+	static const UINT32 kDefaultTwistAxis = 4;
+	static const UINT32 kDefaultThrottleAxis = 3;
+
+	explicit Joystick(UINT32 port);
+	Joystick(UINT32 port, UINT32 numAxisTypes, UINT32 numButtonTypes);
+	virtual ~Joystick();
+
+	virtual float GetX(JoystickHand hand = kRightHand);
+	virtual float GetY(JoystickHand hand = kRightHand);
+	virtual float GetZ();
+	virtual float GetTwist();
+	virtual float GetThrottle();
+	virtual float GetRawAxis(UINT32 axis);
+
+	virtual bool GetTrigger(JoystickHand hand = kRightHand);
+	virtual bool GetTop(JoystickHand hand = kRightHand);
+	virtual bool GetBumper(JoystickHand hand = kRightHand);
+	virtual bool GetRawButton(UINT32 button);
+
+private:
+	DriverStation *m_ds;
+	UINT32 m_port;
+	DISALLOW_COPY_AND_ASSIGN(Joystick);
+};
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef NETWORKTABLE_H_
+#define NETWORKTABLE_H_
+
+// The robot code only includes this header; the SmartDashboard stand-in
+// does not need a network table implementation behind it.
+class NetworkTable;
+
+#endif
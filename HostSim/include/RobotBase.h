@@ -0,0 +1,40 @@
+#ifndef ROBOTBASE_H_
+#define ROBOTBASE_H_
+
+#include "Base.h"
+
+class DriverStation;
+
+// On the cRIO this macro also registers a vxWorks startup hook; on the
+// host the harness calls the factory directly.
+#define START_ROBOT_CLASS(_ClassName_) \
+	RobotBase *FRC_userClassFactory() \
+	{ \
+		return new _ClassName_(); \
+	}
+
+class RobotBase
+{
+public:
+	virtual ~RobotBase();
+
+	bool IsEnabled();
+	bool IsDisabled();
+	bool IsAutonomous();
+	bool IsOperatorControl();
+	bool IsTest();
+	bool IsNewDataAvailable();
+	virtual void StartCompetition() = 0;
+
+protected:
+	RobotBase();
+
+	DriverStation *m_ds;
+
+private:
+	DISALLOW_COPY_AND_ASSIGN(RobotBase);
+};
+
+RobotBase *FRC_userClassFactory();
+
+#endif
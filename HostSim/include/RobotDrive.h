@@ -0,0 +1,60 @@
+#ifndef ROBOTDRIVE_H_
+#define ROBOTDRIVE_H_
+
+#include "Base.h"
+
+class SpeedController;
+class GenericHID;
+
+// Same drive math as the WPILib class so the simulated motor outputs match
+// what the robot would command.
+class RobotDrive
+{
+public:
+	typedef enum
+	{
+		kFrontLeftMotor = 0,
+		kFrontRightMotor = 1,
+		kRearLeftMotor = 2,
+		kRearRightMotor = 3
+	} MotorType;
+
+	RobotDrive(SpeedController *frontLeftMotor, SpeedController *rearLeftMotor,
+			SpeedController *frontRightMotor, SpeedController *rearRightMotor);
+	virtual ~RobotDrive();
+
+	void Drive(float outputMagnitude, float curve);
+	void ArcadeDrive(GenericHID *stick, bool squaredInputs = true);
+	void ArcadeDrive(GenericHID &stick, bool squaredInputs = true);
+	void ArcadeDrive(float moveValue, float rotateValue, bool squaredInputs = true);
+	void TankDrive(float leftValue, float rightValue, bool squaredInputs = true);
+	virtual void SetLeftRightMotorOutputs(float leftOutput, float rightOutput);
+	void SetInvertedMotor(MotorType motor, bool isInverted);
+	void SetSensitivity(float sensitivity);
+	void SetMaxOutput(double maxOutput);
+
+	void SetExpiration(float timeout);
+	float GetExpiration();
+	bool IsSafetyEnabled();
+	void SetSafetyEnabled(bool enabled);
+	void StopMotor();
+
+protected:
+	static float Limit(float num);
+
+	static const INT32 kMaxNumberOfMotors = 4;
+	INT32 m_invertedMotors[kMaxNumberOfMotors];
+	float m_sensitivity;
+	double m_maxOutput;
+	float m_expiration;
+	bool m_safetyEnabled;
+	SpeedController *m_frontLeftMotor;
+	SpeedController *m_frontRightMotor;
+	SpeedController *m_rearLeftMotor;
+	SpeedController *m_rearRightMotor;
+
+private:
+	DISALLOW_COPY_AND_ASSIGN(RobotDrive);
+};
+
+#endif
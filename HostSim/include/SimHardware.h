@@ -0,0 +1,113 @@
+#ifndef SIMHARDWARE_H_
+#define SIMHARDWARE_H_
+
+#include "Base.h"
+
+// Host-side stand-in for the cRIO I/O modules and the driver station.
+// Every simulated WPILib object reads and writes its channel here, and the
+// harness plant model closes the loop between the outputs and the sensors
+// each time the robot code calls Wait().
+//
+// Channel arrays are indexed by the (1-based) channel numbers used in
+// BasicDefines.h, so element 0 is unused.
+
+#define SIM_NUM_PWM      11
+#define SIM_NUM_DIO      15
+#define SIM_NUM_ANALOG   9
+#define SIM_NUM_SOLENOID 9
+#define SIM_NUM_RELAY    9
+#define SIM_NUM_STICKS   5
+#define SIM_NUM_AXES     7
+
+typedef enum
+{
+	kSimDisabled, kSimAutonomous, kSimOperatorControl, kSimTest, kSimMatchOver
+} SimMode;
+
+typedef void (*SimInterruptHandler)(UINT32 interruptAssertedMask, void *param);
+
+// Edge interrupts requested on a digital input (see DigitalInput). Sim
+// checks the input each time the plant has stepped and calls the handler
+// for each edge asked for, with the step time as its timestamp.
+typedef struct
+{
+	SimInterruptHandler handler;
+	void  *param;
+	bool   risingEdge;
+	bool   fallingEdge;
+	bool   enabled;
+	bool   level;                       // level at the last check
+	double timestamp;                   // time of the last edge reported
+} SimInterrupt;
+
+typedef struct
+{
+	float  pwm[SIM_NUM_PWM];
+	bool   dio[SIM_NUM_DIO];
+	SimInterrupt interrupt[SIM_NUM_DIO];
+	INT32  encoderCount[SIM_NUM_DIO];   // indexed by the encoder A channel
+	float  encoderRate[SIM_NUM_DIO];    // counts per second, same indexing
+	float  analog[SIM_NUM_ANALOG];
+	bool   solenoid[SIM_NUM_SOLENOID];
+	bool   relayForward[SIM_NUM_RELAY];
+	float  stickAxis[SIM_NUM_STICKS][SIM_NUM_AXES];
+	UINT16 stickButtons[SIM_NUM_STICKS];
+
+	// Compressor wiring, filled in by the Compressor object.
+	bool   compressorEnabled;
+	UINT32 compressorSwitchChannel;
+	UINT32 compressorRelayChannel;
+
+	SimMode mode;
+} SimHardware;
+
+// Time the robot code spent between consecutive Wait() calls, split by the
+// mode the driver station was in. In OperatorControl this is the cost of
+// one pass through the teleop loop.
+typedef struct
+{
+	UINT32 iterations;
+	double busyTotal;
+	double busyMax;
+} SimLoopStats;
+
+typedef struct
+{
+	SimLoopStats loop[kSimMatchOver];
+	UINT32 dashboardPuts;
+	UINT32 dashboardBytes;
+	UINT32 lcdFormats;
+	UINT32 lcdUpdates;
+} SimStats;
+
+// Called after simulated time has advanced, with the new time and the
+// elapsed step in seconds.
+typedef void (*SimStepHook)(double now, double dt);
+
+class Sim
+{
+public:
+	static SimHardware &Hardware();
+	static SimStats &Stats();
+
+	// Simulated time in seconds since the start of the run. In accelerated
+	// mode time only moves when the robot code waits; in real-time mode it
+	// follows the wall clock.
+	static double Now();
+	static double WallClock();
+	static void SetRealTime(bool realTime);
+	static bool IsRealTime();
+
+	static void SetStepHook(SimStepHook hook);
+	static void Advance(double seconds);
+	static void SetMode(SimMode mode);
+
+	// Background tasks (see Task.h). Wait() from a task thread goes to
+	// TaskWait; RunTasks runs every task that is due and returns once they
+	// are all waiting again (a no-op in real-time mode).
+	static bool InTask();
+	static void TaskWait(double seconds);
+	static void RunTasks();
+};
+
+#endif
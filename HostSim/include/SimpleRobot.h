@@ -0,0 +1,26 @@
+#ifndef SIMPLEROBOT_H_
+#define SIMPLEROBOT_H_
+
+#include "RobotBase.h"
+
+class SimpleRobot : public RobotBase
+{
+public:
+	SimpleRobot();
+	virtual ~SimpleRobot() {}
+
+	virtual void RobotInit();
+	virtual void Disabled();
+	virtual void Autonomous();
+	virtual void OperatorControl();
+	virtual void Test();
+	virtual void RobotMain();
+
+	// Runs until the simulated match is over rather than forever.
+	void StartCompetition();
+
+private:
+	bool m_robotMainOverridden;
+};
+
+#endif
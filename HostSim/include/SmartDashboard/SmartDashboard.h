@@ -0,0 +1,24 @@
+#ifndef SMARTDASHBOARD_H_
+#define SMARTDASHBOARD_H_
+
+#include <string>
+
+// Same std::string based interface as the 2013 SmartDashboard, so every
+// call pays for the key construction just like it does on the robot. The
+// host version counts entries and an estimate of the bytes that would go
+// out over network tables.
+class SmartDashboard
+{
+public:
+	static void PutNumber(std::string key, double value);
+	static double GetNumber(std::string key);
+	static void PutBoolean(std::string key, bool value);
+	static bool GetBoolean(std::string key);
+	static void PutString(std::string key, std::string value);
+	static std::string GetString(std::string key);
+
+private:
+	SmartDashboard();
+};
+
+#endif
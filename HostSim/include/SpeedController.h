@@ -0,0 +1,55 @@
+#ifndef SPEEDCONTROLLER_H_
+#define SPEEDCONTROLLER_H_
+
+#include "Base.h"
+
+class SpeedController
+{
+public:
+	virtual ~SpeedController() {}
+	virtual void Set(float speed, UINT8 syncGroup = 0) = 0;
+	virtual float Get() = 0;
+	virtual void Disable() = 0;
+};
+
+// Host-only common base for the PWM motor controllers. The commanded value
+// is clamped to [-1, 1] and published on the PWM channel.
+class SimPWMSpeedController : public SpeedController
+{
+public:
+	explicit SimPWMSpeedController(UINT32 channel);
+	SimPWMSpeedController(UINT8 moduleNumber, UINT32 channel);
+	virtual ~SimPWMSpeedController();
+
+	virtual void Set(float speed, UINT8 syncGroup = 0);
+	virtual float Get();
+	virtual void Disable();
+	UINT32 GetChannel() { return m_channel; }
+
+private:
+	UINT32 m_channel;
+	float m_speed;
+};
+
+class Victor : public SimPWMSpeedController
+{
+public:
+	explicit Victor(UINT32 channel) : SimPWMSpeedController(channel) {}
+	Victor(UINT8 moduleNumber, UINT32 channel) : SimPWMSpeedController(moduleNumber, channel) {}
+};
+
+class Jaguar : public SimPWMSpeedController
+{
+public:
+	explicit Jaguar(UINT32 channel) : SimPWMSpeedController(channel) {}
+	Jaguar(UINT8 moduleNumber, UINT32 channel) : SimPWMSpeedController(moduleNumber, channel) {}
+};
+
+class Talon : public SimPWMSpeedController
+{
+public:
+	explicit Talon(UINT32 channel) : SimPWMSpeedController(channel) {}
+	Talon(UINT8 moduleNumber, UINT32 channel) : SimPWMSpeedController(moduleNumber, channel) {}
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "Base.h"
+#include <pthread.h>
+
+// Host stand-in for the WPILib Task wrapper around vxWorks tasks. Each task
+// is a pthread; priority and stack size are recorded but not used.
+//
+// In accelerated mode simulated time only moves when the robot thread
+// waits, so tasks run in lockstep with it: a Wait() in a task sleeps until
+// simulated time reaches the wake-up time, and the robot thread does not
+// return from its own Wait() until every task that was due has run and is
+// waiting again. Start() likewise returns once the new task first waits.
+// The result is as if the tasks ran at lower priority than the robot
+// thread, and a run is repeatable.
+class Task
+{
+public:
+	static const UINT32 kDefaultPriority = 101;
+	static const INT32 kInvalidTaskID = -1;
+
+	Task(const char *name, FUNCPTR function, INT32 priority = kDefaultPriority,
+			UINT32 stackSize = 20000);
+	virtual ~Task();
+
+	// The arguments are UINT32 on the cRIO, where that is pointer sized.
+	// Here they are size_t so a pointer passed as (size_t)p survives.
+	bool Start(size_t arg0 = 0, size_t arg1 = 0, size_t arg2 = 0, size_t arg3 = 0,
+			size_t arg4 = 0, size_t arg5 = 0, size_t arg6 = 0, size_t arg7 = 0,
+			size_t arg8 = 0, size_t arg9 = 0);
+	bool Stop();
+
+	bool IsReady();
+	bool Verify();
+	INT32 GetPriority();
+	bool SetPriority(INT32 priority);
+	const char *GetName();
+	INT32 GetID();
+
+private:
+	friend class Sim;
+	static void *Entry(void *task);
+	static void Retire(Task *task);
+
+	const char *m_name;
+	FUNCPTR m_function;
+	INT32 m_priority;
+	UINT32 m_stackSize;
+	size_t m_args[10];
+	INT32 m_id;
+
+	pthread_t m_thread;
+	bool m_running;     // thread exists and has not finished
+	bool m_awake;       // scheduled to run (not blocked in Wait)
+	bool m_stopping;
+	double m_wakeTime;
+	DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+#endif
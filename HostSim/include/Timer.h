@@ -0,0 +1,32 @@
+#ifndef TIMER_H_
+#define TIMER_H_
+
+#include "Base.h"
+
+void Wait(double seconds);
+double GetClock();
+double GetTime();
+
+class Timer
+{
+public:
+	Timer();
+	virtual ~Timer();
+
+	double Get();
+	void Reset();
+	void Start();
+	void Stop();
+	bool HasPeriodPassed(double period);
+
+	static double GetFPGATimestamp();
+	static double GetPPCTimestamp();
+
+private:
+	double m_startTime;
+	double m_accumulatedTime;
+	bool m_running;
+	DISALLOW_COPY_AND_ASSIGN(Timer);
+};
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef UTILITY_H_
+#define UTILITY_H_
+
+#include "Base.h"
+#include <assert.h>
+
+#define wpi_assert(condition) assert(condition)
+
+// Microseconds since the FPGA was started (wraps after ~71 minutes, just
+// like the real counter).
+UINT32 GetFPGATime();
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef WPILIB_H_
+#define WPILIB_H_
+
+// Host (Linux) stand-in for the subset of the 2013 WPILib used by the
+// FRC2994_2013 project. It lets RobotDemo build and run against simulated
+// hardware so loop cost can be measured without a cRIO. See
+// HostSim/README.md.
+
+#include "Base.h"
+#include "Utility.h"
+#include "Timer.h"
+#include "Task.h"
+#include "DriverStation.h"
+#include "DriverStationLCD.h"
+#include "GenericHID.h"
+#include "Joystick.h"
+#include "SpeedController.h"
+#include "RobotDrive.h"
+#include "Encoder.h"
+#include "Counter.h"
+#include "AnalogChannel.h"
+#include "AnalogTrigger.h"
+#include "DigitalInput.h"
+#include "DoubleSolenoid.h"
+#include "Compressor.h"
+#include "RobotBase.h"
+#include "SimpleRobot.h"
+#include "SmartDashboard/SmartDashboard.h"
+
+#endif
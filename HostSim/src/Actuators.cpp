@@ -0,0 +1,328 @@
+#include "SpeedController.h"
+#include "RobotDrive.h"
+#include "GenericHID.h"
+#include "DoubleSolenoid.h"
+#include "Compressor.h"
+#include "SimHardware.h"
+
+#include <math.h>
+
+SimPWMSpeedController::SimPWMSpeedController(UINT32 channel):
+	m_channel(channel),
+	m_speed(0.0)
+{
+}
+
+SimPWMSpeedController::SimPWMSpeedController(UINT8 moduleNumber, UINT32 channel):
+	m_channel(channel),
+	m_speed(0.0)
+{
+}
+
+SimPWMSpeedController::~SimPWMSpeedController()
+{
+}
+
+void SimPWMSpeedController::Set(float speed, UINT8 syncGroup)
+{
+	if (speed > 1.0)
+	{
+		speed = 1.0;
+	}
+	else if (speed < -1.0)
+	{
+		speed = -1.0;
+	}
+	m_speed = speed;
+	if (m_channel < SIM_NUM_PWM)
+	{
+		Sim::Hardware().pwm[m_channel] = speed;
+	}
+}
+
+float SimPWMSpeedController::Get()
+{
+	return m_speed;
+}
+
+void SimPWMSpeedController::Disable()
+{
+	Set(0.0);
+}
+
+RobotDrive::RobotDrive(SpeedController *frontLeftMotor, SpeedController *rearLeftMotor,
+		SpeedController *frontRightMotor, SpeedController *rearRightMotor):
+	m_sensitivity(0.5),
+	m_maxOutput(1.0),
+	m_expiration(0.1),
+	m_safetyEnabled(true),
+	m_frontLeftMotor(frontLeftMotor),
+	m_frontRightMotor(frontRightMotor),
+	m_rearLeftMotor(rearLeftMotor),
+	m_rearRightMotor(rearRightMotor)
+{
+	for (INT32 i = 0; i < kMaxNumberOfMotors; i++)
+	{
+		m_invertedMotors[i] = 1;
+	}
+	SetLeftRightMotorOutputs(0.0, 0.0);
+}
+
+RobotDrive::~RobotDrive()
+{
+}
+
+void RobotDrive::Drive(float outputMagnitude, float curve)
+{
+	float leftOutput, rightOutput;
+
+	if (curve < 0)
+	{
+		float value = log(-curve);
+		float ratio = (value - m_sensitivity)/(value + m_sensitivity);
+		if (ratio == 0) ratio =.0000000001;
+		leftOutput = outputMagnitude / ratio;
+		rightOutput = outputMagnitude;
+	}
+	else if (curve > 0)
+	{
+		float value = log(curve);
+		float ratio = (value - m_sensitivity)/(value + m_sensitivity);
+		if (ratio == 0) ratio =.0000000001;
+		leftOutput = outputMagnitude;
+		rightOutput = outputMagnitude / ratio;
+	}
+	else
+	{
+		leftOutput = outputMagnitude;
+		rightOutput = outputMagnitude;
+	}
+	SetLeftRightMotorOutputs(leftOutput, rightOutput);
+}
+
+void RobotDrive::ArcadeDrive(GenericHID *stick, bool squaredInputs)
+{
+	ArcadeDrive(stick->GetY(), stick->GetX(), squaredInputs);
+}
+
+void RobotDrive::ArcadeDrive(GenericHID &stick, bool squaredInputs)
+{
+	ArcadeDrive(stick.GetY(), stick.GetX(), squaredInputs);
+}
+
+void RobotDrive::ArcadeDrive(float moveValue, float rotateValue, bool squaredInputs)
+{
+	float leftMotorOutput;
+	float rightMotorOutput;
+
+	moveValue = Limit(moveValue);
+	rotateValue = Limit(rotateValue);
+
+	if (squaredInputs)
+	{
+		// square the inputs (while preserving the sign) to increase fine control while permitting full power
+		if (moveValue >= 0.0)
+		{
+			moveValue = (moveValue * moveValue);
+		}
+		else
+		{
+			moveValue = -(moveValue * moveValue);
+		}
+		if (rotateValue >= 0.0)
+		{
+			rotateValue = (rotateValue * rotateValue);
+		}
+		else
+		{
+			rotateValue = -(rotateValue * rotateValue);
+		}
+	}
+
+	if (moveValue > 0.0)
+	{
+		if (rotateValue > 0.0)
+		{
+			leftMotorOutput = moveValue - rotateValue;
+			rightMotorOutput = moveValue > rotateValue ? moveValue : rotateValue;
+		}
+		else
+		{
+			leftMotorOutput = moveValue > -rotateValue ? moveValue : -rotateValue;
+			rightMotorOutput = moveValue + rotateValue;
+		}
+	}
+	else
+	{
+		if (rotateValue > 0.0)
+		{
+			leftMotorOutput = - (-moveValue > rotateValue ? -moveValue : rotateValue);
+			rightMotorOutput = moveValue + rotateValue;
+		}
+		else
+		{
+			leftMotorOutput = moveValue - rotateValue;
+			rightMotorOutput = - (-moveValue > -rotateValue ? -moveValue : -rotateValue);
+		}
+	}
+	SetLeftRightMotorOutputs(leftMotorOutput, rightMotorOutput);
+}
+
+void RobotDrive::TankDrive(float leftValue, float rightValue, bool squaredInputs)
+{
+	leftValue = Limit(leftValue);
+	rightValue = Limit(rightValue);
+	if (squaredInputs)
+	{
+		leftValue = leftValue >= 0.0 ? leftValue * leftValue : -(leftValue * leftValue);
+		rightValue = rightValue >= 0.0 ? rightValue * rightValue : -(rightValue * rightValue);
+	}
+	SetLeftRightMotorOutputs(leftValue, rightValue);
+}
+
+void RobotDrive::SetLeftRightMotorOutputs(float leftOutput, float rightOutput)
+{
+	m_frontLeftMotor->Set(Limit(leftOutput) * m_invertedMotors[kFrontLeftMotor] * m_maxOutput);
+	m_rearLeftMotor->Set(Limit(leftOutput) * m_invertedMotors[kRearLeftMotor] * m_maxOutput);
+	m_frontRightMotor->Set(-Limit(rightOutput) * m_invertedMotors[kFrontRightMotor] * m_maxOutput);
+	m_rearRightMotor->Set(-Limit(rightOutput) * m_invertedMotors[kRearRightMotor] * m_maxOutput);
+}
+
+float RobotDrive::Limit(float num)
+{
+	if (num > 1.0)
+	{
+		return 1.0;
+	}
+	if (num < -1.0)
+	{
+		return -1.0;
+	}
+	return num;
+}
+
+void RobotDrive::SetInvertedMotor(MotorType motor, bool isInverted)
+{
+	if (motor < 0 || motor > 3)
+	{
+		return;
+	}
+	m_invertedMotors[motor] = isInverted ? -1 : 1;
+}
+
+void RobotDrive::SetSensitivity(float sensitivity)
+{
+	m_sensitivity = sensitivity;
+}
+
+void RobotDrive::SetMaxOutput(double maxOutput)
+{
+	m_maxOutput = maxOutput;
+}
+
+void RobotDrive::SetExpiration(float timeout)
+{
+	m_expiration = timeout;
+}
+
+float RobotDrive::GetExpiration()
+{
+	return m_expiration;
+}
+
+bool RobotDrive::IsSafetyEnabled()
+{
+	return m_safetyEnabled;
+}
+
+void RobotDrive::SetSafetyEnabled(bool enabled)
+{
+	m_safetyEnabled = enabled;
+}
+
+void RobotDrive::StopMotor()
+{
+	SetLeftRightMotorOutputs(0.0, 0.0);
+}
+
+DoubleSolenoid::DoubleSolenoid(UINT32 forwardChannel, UINT32 reverseChannel):
+	m_forwardChannel(forwardChannel),
+	m_reverseChannel(reverseChannel)
+{
+}
+
+DoubleSolenoid::DoubleSolenoid(UINT8 moduleNumber, UINT32 forwardChannel, UINT32 reverseChannel):
+	m_forwardChannel(forwardChannel),
+	m_reverseChannel(reverseChannel)
+{
+}
+
+DoubleSolenoid::~DoubleSolenoid()
+{
+}
+
+void DoubleSolenoid::Set(Value value)
+{
+	SimHardware &hw = Sim::Hardware();
+	hw.solenoid[m_forwardChannel] = (kForward == value);
+	hw.solenoid[m_reverseChannel] = (kReverse == value);
+}
+
+DoubleSolenoid::Value DoubleSolenoid::Get()
+{
+	SimHardware &hw = Sim::Hardware();
+	if (hw.solenoid[m_forwardChannel])
+	{
+		return kForward;
+	}
+	if (hw.solenoid[m_reverseChannel])
+	{
+		return kReverse;
+	}
+	return kOff;
+}
+
+Compressor::Compressor(UINT32 pressureSwitchChannel, UINT32 compressorRelayChannel):
+	m_pressureSwitchChannel(pressureSwitchChannel),
+	m_relayChannel(compressorRelayChannel)
+{
+	SimHardware &hw = Sim::Hardware();
+	hw.compressorSwitchChannel = pressureSwitchChannel;
+	hw.compressorRelayChannel = compressorRelayChannel;
+}
+
+Compressor::Compressor(UINT8 pressureSwitchModuleNumber, UINT32 pressureSwitchChannel,
+		UINT8 compresssorRelayModuleNumber, UINT32 compressorRelayChannel):
+	m_pressureSwitchChannel(pressureSwitchChannel),
+	m_relayChannel(compressorRelayChannel)
+{
+	SimHardware &hw = Sim::Hardware();
+	hw.compressorSwitchChannel = pressureSwitchChannel;
+	hw.compressorRelayChannel = compressorRelayChannel;
+}
+
+Compressor::~Compressor()
+{
+	Stop();
+}
+
+void Compressor::Start()
+{
+	Sim::Hardware().compressorEnabled = true;
+}
+
+void Compressor::Stop()
+{
+	Sim::Hardware().compressorEnabled = false;
+	Sim::Hardware().relayForward[m_relayChannel] = false;
+}
+
+bool Compressor::Enabled()
+{
+	return Sim::Hardware().compressorEnabled;
+}
+
+UINT32 Compressor::GetPressureSwitchValue()
+{
+	return Sim::Hardware().dio[m_pressureSwitchChannel];
+}
@@ -0,0 +1,233 @@
+#include "DriverStation.h"
+#include "DriverStationLCD.h"
+#include "Joystick.h"
+#include "SimHardware.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+// Like the semaphore in the WPILib version, so tasks other than the robot
+// thread can write to the LCD. Recursive because PrintfLine goes through
+// VPrintf.
+static pthread_mutex_t s_lcdLock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+DriverStation::DriverStation()
+{
+}
+
+DriverStation *DriverStation::GetInstance()
+{
+	static DriverStation instance;
+	return &instance;
+}
+
+float DriverStation::GetStickAxis(UINT32 stick, UINT32 axis)
+{
+	if (stick < 1 || stick > kJoystickPorts || axis < 1 || axis > kJoystickAxes)
+	{
+		return 0.0;
+	}
+	return Sim::Hardware().stickAxis[stick][axis];
+}
+
+short DriverStation::GetStickButtons(UINT32 stick)
+{
+	if (stick < 1 || stick > kJoystickPorts)
+	{
+		return 0;
+	}
+	return (short)Sim::Hardware().stickButtons[stick];
+}
+
+bool DriverStation::IsEnabled()
+{
+	SimMode mode = Sim::Hardware().mode;
+	return mode != kSimDisabled && mode != kSimMatchOver;
+}
+
+bool DriverStation::IsDisabled()
+{
+	return !IsEnabled();
+}
+
+bool DriverStation::IsAutonomous()
+{
+	return Sim::Hardware().mode == kSimAutonomous;
+}
+
+bool DriverStation::IsOperatorControl()
+{
+	return Sim::Hardware().mode == kSimOperatorControl;
+}
+
+bool DriverStation::IsTest()
+{
+	return Sim::Hardware().mode == kSimTest;
+}
+
+bool DriverStation::IsNewControlData()
+{
+	return true;
+}
+
+float DriverStation::GetBatteryVoltage()
+{
+	return 12.5;
+}
+
+DriverStationLCD::DriverStationLCD()
+{
+	memset(m_textBuffer, ' ', sizeof(m_textBuffer));
+	memset(m_sentBuffer, 0, sizeof(m_sentBuffer));
+}
+
+DriverStationLCD *DriverStationLCD::GetInstance()
+{
+	static DriverStationLCD instance;
+	return &instance;
+}
+
+void DriverStationLCD::UpdateLCD()
+{
+	pthread_mutex_lock(&s_lcdLock);
+	for (INT32 i = 0; i < kNumLines; i++)
+	{
+		memcpy(m_sentBuffer[i], m_textBuffer[i], kLineLength);
+		m_sentBuffer[i][kLineLength] = '\0';
+	}
+	Sim::Stats().lcdUpdates++;
+	pthread_mutex_unlock(&s_lcdLock);
+}
+
+void DriverStationLCD::Printf(Line line, INT32 startingColumn, const char *writeFmt, ...)
+{
+	va_list args;
+	va_start(args, writeFmt);
+	VPrintf(line, startingColumn, writeFmt, args);
+	va_end(args);
+}
+
+void DriverStationLCD::VPrintf(Line line, INT32 startingColumn, const char *writeFmt, va_list args)
+{
+	if (line < kUser_Line1 || line > kUser_Line6 || startingColumn < 1 || startingColumn > kLineLength)
+	{
+		return;
+	}
+
+	char lineBuffer[kLineLength + 1];
+	INT32 start = startingColumn - 1;
+	INT32 length = vsnprintf(lineBuffer, sizeof(lineBuffer), writeFmt, args);
+	if (length < 0)
+	{
+		return;
+	}
+	if (length > kLineLength - start)
+	{
+		length = kLineLength - start;
+	}
+	pthread_mutex_lock(&s_lcdLock);
+	memcpy(m_textBuffer[line] + start, lineBuffer, length);
+	Sim::Stats().lcdFormats++;
+	pthread_mutex_unlock(&s_lcdLock);
+}
+
+void DriverStationLCD::PrintfLine(Line line, const char *writeFmt, ...)
+{
+	va_list args;
+	va_start(args, writeFmt);
+	VPrintfLine(line, writeFmt, args);
+	va_end(args);
+}
+
+void DriverStationLCD::VPrintfLine(Line line, const char *writeFmt, va_list args)
+{
+	if (line < kUser_Line1 || line > kUser_Line6)
+	{
+		return;
+	}
+
+	// PrintfLine pads the rest of the line with spaces.
+	pthread_mutex_lock(&s_lcdLock);
+	memset(m_textBuffer[line], ' ', kLineLength);
+	VPrintf(line, 1, writeFmt, args);
+	pthread_mutex_unlock(&s_lcdLock);
+}
+
+void DriverStationLCD::Clear()
+{
+	pthread_mutex_lock(&s_lcdLock);
+	memset(m_textBuffer, ' ', sizeof(m_textBuffer));
+	pthread_mutex_unlock(&s_lcdLock);
+}
+
+const char *DriverStationLCD::GetSentLine(Line line)
+{
+	return m_sentBuffer[line];
+}
+
+Joystick::Joystick(UINT32 port):
+	m_ds(DriverStation::GetInstance()),
+	m_port(port)
+{
+}
+
+Joystick::Joystick(UINT32 port, UINT32 numAxisTypes, UINT32 numButtonTypes):
+	m_ds(DriverStation::GetInstance()),
+	m_port(port)
+{
+}
+
+Joystick::~Joystick()
+{
+}
+
+float Joystick::GetX(JoystickHand hand)
+{
+	return GetRawAxis(kDefaultXAxis);
+}
+
+float Joystick::GetY(JoystickHand hand)
+{
+	return GetRawAxis(kDefaultYAxis);
+}
+
+float Joystick::GetZ()
+{
+	return GetRawAxis(kDefaultZAxis);
+}
+
+float Joystick::GetTwist()
+{
+	return GetRawAxis(kDefaultTwistAxis);
+}
+
+float Joystick::GetThrottle()
+{
+	return GetRawAxis(kDefaultThrottleAxis);
+}
+
+float Joystick::GetRawAxis(UINT32 axis)
+{
+	return m_ds->GetStickAxis(m_port, axis);
+}
+
+bool Joystick::GetTrigger(JoystickHand hand)
+{
+	return GetRawButton(1);
+}
+
+bool Joystick::GetTop(JoystickHand hand)
+{
+	return GetRawButton(2);
+}
+
+bool Joystick::GetBumper(JoystickHand hand)
+{
+	return false;
+}
+
+bool Joystick::GetRawButton(UINT32 button)
+{
+	return ((0x1 << (button-1)) & m_ds->GetStickButtons(m_port)) != 0;
+}
@@ -0,0 +1,111 @@
+#include "RobotBase.h"
+#include "SimpleRobot.h"
+#include "DriverStation.h"
+#include "SimHardware.h"
+#include "Timer.h"
+
+RobotBase::RobotBase():
+	m_ds(DriverStation::GetInstance())
+{
+}
+
+RobotBase::~RobotBase()
+{
+}
+
+bool RobotBase::IsEnabled()
+{
+	return m_ds->IsEnabled();
+}
+
+bool RobotBase::IsDisabled()
+{
+	return m_ds->IsDisabled();
+}
+
+bool RobotBase::IsAutonomous()
+{
+	return m_ds->IsAutonomous();
+}
+
+bool RobotBase::IsOperatorControl()
+{
+	return m_ds->IsOperatorControl();
+}
+
+bool RobotBase::IsTest()
+{
+	return m_ds->IsTest();
+}
+
+bool RobotBase::IsNewDataAvailable()
+{
+	return m_ds->IsNewControlData();
+}
+
+SimpleRobot::SimpleRobot():
+	m_robotMainOverridden(true)
+{
+}
+
+void SimpleRobot::RobotInit()
+{
+}
+
+void SimpleRobot::Disabled()
+{
+}
+
+void SimpleRobot::Autonomous()
+{
+}
+
+void SimpleRobot::OperatorControl()
+{
+}
+
+void SimpleRobot::Test()
+{
+}
+
+void SimpleRobot::RobotMain()
+{
+	m_robotMainOverridden = false;
+}
+
+// Same mode dispatch as the WPILib SimpleRobot, except that it returns once
+// the harness ends the match.
+void SimpleRobot::StartCompetition()
+{
+	RobotMain();
+	if (m_robotMainOverridden)
+	{
+		return;
+	}
+
+	RobotInit();
+
+	while (Sim::Hardware().mode != kSimMatchOver)
+	{
+		if (IsDisabled())
+		{
+			Disabled();
+			while (IsDisabled() && Sim::Hardware().mode != kSimMatchOver) Wait(0.01);
+		}
+		else if (IsAutonomous())
+		{
+			Autonomous();
+			while (IsAutonomous() && IsEnabled()) Wait(0.01);
+		}
+		else if (IsTest())
+		{
+			Test();
+			while (IsTest() && IsEnabled()) Wait(0.01);
+		}
+		else
+		{
+			OperatorControl();
+			while (IsOperatorControl() && IsEnabled()) Wait(0.01);
+		}
+	}
+}
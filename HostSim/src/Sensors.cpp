@@ -0,0 +1,374 @@
+#include "Encoder.h"
+#include "Counter.h"
+#include "AnalogChannel.h"
+#include "AnalogTrigger.h"
+#include "DigitalInput.h"
+#include "SimHardware.h"
+
+#include <math.h>
+
+// Conversion used by the cRIO 9201 analog module: 12 bit over +/-10 V.
+#define SIM_ANALOG_LSB_VOLTS (10.0 / 2048.0)
+
+Encoder::Encoder(UINT32 aChannel, UINT32 bChannel, bool reverseDirection, EncodingType encodingType):
+	m_aChannel(aChannel),
+	m_reverseDirection(reverseDirection),
+	m_running(false),
+	m_offset(0),
+	m_stoppedCount(0),
+	m_distancePerPulse(1.0),
+	m_maxPeriod(0.5)
+{
+}
+
+Encoder::Encoder(UINT8 aModuleNumber, UINT32 aChannel, UINT8 bModuleNumber, UINT32 bChannel,
+		bool reverseDirection, EncodingType encodingType):
+	m_aChannel(aChannel),
+	m_reverseDirection(reverseDirection),
+	m_running(false),
+	m_offset(0),
+	m_stoppedCount(0),
+	m_distancePerPulse(1.0),
+	m_maxPeriod(0.5)
+{
+}
+
+Encoder::~Encoder()
+{
+}
+
+INT32 Encoder::HardwareCount()
+{
+	return Sim::Hardware().encoderCount[m_aChannel];
+}
+
+void Encoder::Start()
+{
+	if (!m_running)
+	{
+		INT32 sign = m_reverseDirection ? -1 : 1;
+		m_offset = HardwareCount() - sign * m_stoppedCount;
+		m_running = true;
+	}
+}
+
+INT32 Encoder::GetRaw()
+{
+	if (!m_running)
+	{
+		return m_stoppedCount;
+	}
+	INT32 count = HardwareCount() - m_offset;
+	return m_reverseDirection ? -count : count;
+}
+
+INT32 Encoder::Get()
+{
+	return GetRaw();
+}
+
+void Encoder::Reset()
+{
+	m_offset = HardwareCount();
+	m_stoppedCount = 0;
+}
+
+void Encoder::Stop()
+{
+	m_stoppedCount = GetRaw();
+	m_running = false;
+}
+
+double Encoder::GetPeriod()
+{
+	double rate = fabs(Sim::Hardware().encoderRate[m_aChannel]);
+	if (rate <= 0.0 || 1.0 / rate > m_maxPeriod)
+	{
+		return m_maxPeriod;
+	}
+	return 1.0 / rate;
+}
+
+void Encoder::SetMaxPeriod(double maxPeriod)
+{
+	m_maxPeriod = maxPeriod;
+}
+
+bool Encoder::GetStopped()
+{
+	return GetPeriod() >= m_maxPeriod;
+}
+
+bool Encoder::GetDirection()
+{
+	float rate = Sim::Hardware().encoderRate[m_aChannel];
+	return m_reverseDirection ? rate < 0.0 : rate >= 0.0;
+}
+
+double Encoder::GetDistance()
+{
+	return GetRaw() * m_distancePerPulse;
+}
+
+double Encoder::GetRate()
+{
+	if (!m_running || GetStopped())
+	{
+		return 0.0;
+	}
+	double rate = Sim::Hardware().encoderRate[m_aChannel] * m_distancePerPulse;
+	return m_reverseDirection ? -rate : rate;
+}
+
+void Encoder::SetMinRate(double minRate)
+{
+	m_maxPeriod = m_distancePerPulse / minRate;
+}
+
+void Encoder::SetDistancePerPulse(double distancePerPulse)
+{
+	m_distancePerPulse = distancePerPulse;
+}
+
+void Encoder::SetReverseDirection(bool reverseDirection)
+{
+	m_reverseDirection = reverseDirection;
+}
+
+Counter::Counter(UINT32 channel):
+	m_channel(channel),
+	m_running(false),
+	m_offset(0),
+	m_stoppedCount(0),
+	m_maxPeriod(0.5)
+{
+}
+
+Counter::Counter(UINT8 moduleNumber, UINT32 channel):
+	m_channel(channel),
+	m_running(false),
+	m_offset(0),
+	m_stoppedCount(0),
+	m_maxPeriod(0.5)
+{
+}
+
+Counter::~Counter()
+{
+}
+
+void Counter::Start()
+{
+	if (!m_running)
+	{
+		m_offset = Sim::Hardware().encoderCount[m_channel] - m_stoppedCount;
+		m_running = true;
+	}
+}
+
+INT32 Counter::Get()
+{
+	if (!m_running)
+	{
+		return m_stoppedCount;
+	}
+	return Sim::Hardware().encoderCount[m_channel] - m_offset;
+}
+
+void Counter::Reset()
+{
+	m_offset = Sim::Hardware().encoderCount[m_channel];
+	m_stoppedCount = 0;
+}
+
+void Counter::Stop()
+{
+	m_stoppedCount = Get();
+	m_running = false;
+}
+
+double Counter::GetPeriod()
+{
+	double rate = fabs(Sim::Hardware().encoderRate[m_channel]);
+	if (!m_running || rate <= 0.0 || 1.0 / rate > m_maxPeriod)
+	{
+		return HUGE_VAL;
+	}
+	return 1.0 / rate;
+}
+
+void Counter::SetMaxPeriod(double maxPeriod)
+{
+	m_maxPeriod = maxPeriod;
+}
+
+bool Counter::GetStopped()
+{
+	return GetPeriod() > m_maxPeriod;
+}
+
+AnalogChannel::AnalogChannel(UINT32 channel):
+	m_channel(channel)
+{
+}
+
+AnalogChannel::AnalogChannel(UINT8 moduleNumber, UINT32 channel):
+	m_channel(channel)
+{
+}
+
+AnalogChannel::~AnalogChannel()
+{
+}
+
+INT16 AnalogChannel::GetValue()
+{
+	return (INT16)(GetVoltage() / SIM_ANALOG_LSB_VOLTS);
+}
+
+INT32 AnalogChannel::GetAverageValue()
+{
+	return GetValue();
+}
+
+float AnalogChannel::GetVoltage()
+{
+	return Sim::Hardware().analog[m_channel];
+}
+
+float AnalogChannel::GetAverageVoltage()
+{
+	return GetVoltage();
+}
+
+AnalogTrigger::AnalogTrigger(UINT32 channel):
+	m_channel(channel),
+	m_lower(0.0),
+	m_upper(0.0),
+	m_state(false)
+{
+}
+
+AnalogTrigger::AnalogTrigger(UINT8 moduleNumber, UINT32 channel):
+	m_channel(channel),
+	m_lower(0.0),
+	m_upper(0.0),
+	m_state(false)
+{
+}
+
+AnalogTrigger::AnalogTrigger(AnalogChannel *channel):
+	m_channel(channel->GetChannel()),
+	m_lower(0.0),
+	m_upper(0.0),
+	m_state(false)
+{
+}
+
+AnalogTrigger::~AnalogTrigger()
+{
+}
+
+void AnalogTrigger::SetLimitsVoltage(float lower, float upper)
+{
+	m_lower = lower;
+	m_upper = upper;
+}
+
+void AnalogTrigger::SetAveraged(bool useAveragedValue)
+{
+}
+
+void AnalogTrigger::SetFiltered(bool useFilteredValue)
+{
+}
+
+bool AnalogTrigger::GetInWindow()
+{
+	float voltage = Sim::Hardware().analog[m_channel];
+	return voltage >= m_lower && voltage <= m_upper;
+}
+
+bool AnalogTrigger::GetTriggerState()
+{
+	float voltage = Sim::Hardware().analog[m_channel];
+	if (voltage > m_upper)
+	{
+		m_state = true;
+	}
+	else if (voltage < m_lower)
+	{
+		m_state = false;
+	}
+	return m_state;
+}
+
+DigitalInput::DigitalInput(UINT32 channel):
+	m_channel(channel)
+{
+}
+
+DigitalInput::DigitalInput(UINT8 moduleNumber, UINT32 channel):
+	m_channel(channel)
+{
+}
+
+DigitalInput::~DigitalInput()
+{
+	CancelInterrupts();
+}
+
+UINT32 DigitalInput::Get()
+{
+	return Sim::Hardware().dio[m_channel] ? 1 : 0;
+}
+
+UINT32 DigitalInput::GetChannel()
+{
+	return m_channel;
+}
+
+// As on the FPGA, a new request starts out on the rising edge only and
+// disabled.
+void DigitalInput::RequestInterrupts(tInterruptHandler handler, void *param)
+{
+	SimInterrupt &interrupt = Sim::Hardware().interrupt[m_channel];
+	interrupt.handler = handler;
+	interrupt.param = param;
+	interrupt.risingEdge = true;
+	interrupt.fallingEdge = false;
+	interrupt.enabled = false;
+	interrupt.level = Sim::Hardware().dio[m_channel];
+	interrupt.timestamp = 0.0;
+}
+
+void DigitalInput::CancelInterrupts()
+{
+	SimInterrupt &interrupt = Sim::Hardware().interrupt[m_channel];
+	interrupt.handler = NULL;
+	interrupt.enabled = false;
+}
+
+void DigitalInput::SetUpSourceEdge(bool risingEdge, bool fallingEdge)
+{
+	SimInterrupt &interrupt = Sim::Hardware().interrupt[m_channel];
+	interrupt.risingEdge = risingEdge;
+	interrupt.fallingEdge = fallingEdge;
+}
+
+void DigitalInput::EnableInterrupts()
+{
+	SimInterrupt &interrupt = Sim::Hardware().interrupt[m_channel];
+	interrupt.level = Sim::Hardware().dio[m_channel];
+	interrupt.enabled = true;
+}
+
+void DigitalInput::DisableInterrupts()
+{
+	Sim::Hardware().interrupt[m_channel].enabled = false;
+}
+
+double DigitalInput::ReadInterruptTimestamp()
+{
+	return Sim::Hardware().interrupt[m_channel].timestamp;
+}
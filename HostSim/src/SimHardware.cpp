@@ -0,0 +1,231 @@
+#include "SimHardware.h"
+#include "Timer.h"
+#include "Utility.h"
+
+#include <string.h>
+#include <time.h>
+
+static SimHardware s_hardware;
+static SimStats s_stats;
+static bool s_realTime = false;
+static double s_virtualTime = 0.0;
+static double s_lastStepTime = 0.0;
+static double s_wallStart = -1.0;
+static double s_lastWaitExit = -1.0;
+static SimStepHook s_stepHook = NULL;
+
+SimHardware &Sim::Hardware()
+{
+	return s_hardware;
+}
+
+SimStats &Sim::Stats()
+{
+	return s_stats;
+}
+
+double Sim::WallClock()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	double now = ts.tv_sec + ts.tv_nsec * 1e-9;
+	if (s_wallStart < 0.0)
+	{
+		s_wallStart = now;
+	}
+	return now - s_wallStart;
+}
+
+double Sim::Now()
+{
+	return s_realTime ? WallClock() : s_virtualTime;
+}
+
+void Sim::SetRealTime(bool realTime)
+{
+	s_realTime = realTime;
+	s_lastStepTime = Now();
+}
+
+bool Sim::IsRealTime()
+{
+	return s_realTime;
+}
+
+void Sim::SetStepHook(SimStepHook hook)
+{
+	s_stepHook = hook;
+}
+
+void Sim::SetMode(SimMode mode)
+{
+	s_hardware.mode = mode;
+}
+
+// Report the edges the plant step made on inputs with interrupts enabled.
+static void DeliverInterrupts(double now)
+{
+	for (UINT32 channel = 1; channel < SIM_NUM_DIO; channel++)
+	{
+		SimInterrupt &interrupt = s_hardware.interrupt[channel];
+		bool level = s_hardware.dio[channel];
+		if (NULL == interrupt.handler || level == interrupt.level)
+		{
+			interrupt.level = level;
+			continue;
+		}
+		interrupt.level = level;
+		if (interrupt.enabled && (level ? interrupt.risingEdge : interrupt.fallingEdge))
+		{
+			interrupt.timestamp = now;
+			interrupt.handler(1u << channel, interrupt.param);
+		}
+	}
+}
+
+void Sim::Advance(double seconds)
+{
+	if (s_realTime)
+	{
+		struct timespec ts;
+		ts.tv_sec = (time_t)seconds;
+		ts.tv_nsec = (long)((seconds - ts.tv_sec) * 1e9);
+		nanosleep(&ts, NULL);
+	}
+	else
+	{
+		s_virtualTime += seconds;
+	}
+
+	double now = Now();
+	double dt = now - s_lastStepTime;
+	s_lastStepTime = now;
+
+	// Stand-in for the compressor task: run the pump until the pressure
+	// switch reports a full tank.
+	SimHardware &hw = s_hardware;
+	if (hw.compressorRelayChannel > 0 && hw.compressorRelayChannel < SIM_NUM_RELAY)
+	{
+		hw.relayForward[hw.compressorRelayChannel] =
+			hw.compressorEnabled && !hw.dio[hw.compressorSwitchChannel];
+	}
+
+	if (NULL != s_stepHook)
+	{
+		s_stepHook(now, dt);
+	}
+	DeliverInterrupts(now);
+
+	RunTasks();
+}
+
+// Everything the robot does between two waits is charged to the loop
+// statistics of the current mode.
+void Wait(double seconds)
+{
+	if (Sim::InTask())
+	{
+		Sim::TaskWait(seconds);
+		return;
+	}
+
+	double entry = Sim::WallClock();
+	if (s_lastWaitExit >= 0.0 && s_hardware.mode < kSimMatchOver)
+	{
+		SimLoopStats &loop = s_stats.loop[s_hardware.mode];
+		double busy = entry - s_lastWaitExit;
+		loop.iterations++;
+		loop.busyTotal += busy;
+		if (busy > loop.busyMax)
+		{
+			loop.busyMax = busy;
+		}
+	}
+
+	if (seconds > 0.0)
+	{
+		Sim::Advance(seconds);
+	}
+	s_lastWaitExit = Sim::WallClock();
+}
+
+double GetClock()
+{
+	return Sim::Now();
+}
+
+double GetTime()
+{
+	return Sim::Now();
+}
+
+UINT32 GetFPGATime()
+{
+	return (UINT32)(UINT64)(Sim::Now() * 1e6);
+}
+
+Timer::Timer():
+	m_startTime(0.0),
+	m_accumulatedTime(0.0),
+	m_running(false)
+{
+	Reset();
+}
+
+Timer::~Timer()
+{
+}
+
+double Timer::Get()
+{
+	if (m_running)
+	{
+		return (GetFPGATimestamp() - m_startTime) + m_accumulatedTime;
+	}
+	return m_accumulatedTime;
+}
+
+void Timer::Reset()
+{
+	m_accumulatedTime = 0.0;
+	m_startTime = GetFPGATimestamp();
+}
+
+void Timer::Start()
+{
+	if (!m_running)
+	{
+		m_startTime = GetFPGATimestamp();
+		m_running = true;
+	}
+}
+
+void Timer::Stop()
+{
+	double temp = Get();
+	if (m_running)
+	{
+		m_accumulatedTime = temp;
+		m_running = false;
+	}
+}
+
+bool Timer::HasPeriodPassed(double period)
+{
+	if (Get() > period)
+	{
+		m_startTime += period;
+		return true;
+	}
+	return false;
+}
+
+double Timer::GetFPGATimestamp()
+{
+	return Sim::Now();
+}
+
+double Timer::GetPPCTimestamp()
+{
+	return Sim::Now();
+}
@@ -0,0 +1,52 @@
+#include "SmartDashboard/SmartDashboard.h"
+#include "SimHardware.h"
+
+#include <map>
+
+// Rough size of a network tables entry update on the wire: type, entry id
+// and sequence number ahead of the value.
+#define SIM_NT_UPDATE_OVERHEAD 5
+
+static std::map<std::string, double> s_numbers;
+static std::map<std::string, bool> s_booleans;
+static std::map<std::string, std::string> s_strings;
+
+static void CountPut(const std::string &key, size_t valueBytes)
+{
+	SimStats &stats = Sim::Stats();
+	stats.dashboardPuts++;
+	stats.dashboardBytes += key.size() + valueBytes + SIM_NT_UPDATE_OVERHEAD;
+}
+
+void SmartDashboard::PutNumber(std::string key, double value)
+{
+	s_numbers[key] = value;
+	CountPut(key, sizeof(double));
+}
+
+double SmartDashboard::GetNumber(std::string key)
+{
+	return s_numbers[key];
+}
+
+void SmartDashboard::PutBoolean(std::string key, bool value)
+{
+	s_booleans[key] = value;
+	CountPut(key, 1);
+}
+
+bool SmartDashboard::GetBoolean(std::string key)
+{
+	return s_booleans[key];
+}
+
+void SmartDashboard::PutString(std::string key, std::string value)
+{
+	s_strings[key] = value;
+	CountPut(key, value.size() + 2);
+}
+
+std::string SmartDashboard::GetString(std::string key)
+{
+	return s_strings[key];
+}
@@ -0,0 +1,252 @@
+#include "Task.h"
+#include "SimHardware.h"
+
+#include <string.h>
+#include <time.h>
+
+#define SIM_MAX_TASKS 16
+
+// All task scheduling state is guarded by s_lock. s_running counts tasks
+// that are awake; the robot thread waits on s_idle for it to drop to zero
+// and tasks wait on s_wakeup to be scheduled again.
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t s_idle = PTHREAD_COND_INITIALIZER;
+static UINT32 s_running = 0;
+static Task *s_tasks[SIM_MAX_TASKS];
+static INT32 s_nextID = 1;
+static __thread Task *t_currentTask = NULL;
+
+// Caller holds s_lock.
+static void WaitForIdleTasks()
+{
+	while (s_running > 0)
+	{
+		pthread_cond_wait(&s_idle, &s_lock);
+	}
+}
+
+Task::Task(const char *name, FUNCPTR function, INT32 priority, UINT32 stackSize):
+	m_name(name),
+	m_function(function),
+	m_priority(priority),
+	m_stackSize(stackSize),
+	m_id(kInvalidTaskID),
+	m_running(false),
+	m_awake(false),
+	m_stopping(false),
+	m_wakeTime(0.0)
+{
+	memset(m_args, 0, sizeof(m_args));
+}
+
+Task::~Task()
+{
+	Stop();
+}
+
+bool Task::Start(size_t arg0, size_t arg1, size_t arg2, size_t arg3, size_t arg4,
+		size_t arg5, size_t arg6, size_t arg7, size_t arg8, size_t arg9)
+{
+	pthread_mutex_lock(&s_lock);
+	INT32 slot = -1;
+	for (INT32 i = 0; i < SIM_MAX_TASKS; i++)
+	{
+		if (NULL == s_tasks[i])
+		{
+			slot = i;
+			break;
+		}
+	}
+	if (m_running || slot < 0)
+	{
+		pthread_mutex_unlock(&s_lock);
+		return false;
+	}
+
+	m_args[0] = arg0; m_args[1] = arg1; m_args[2] = arg2; m_args[3] = arg3;
+	m_args[4] = arg4; m_args[5] = arg5; m_args[6] = arg6; m_args[7] = arg7;
+	m_args[8] = arg8; m_args[9] = arg9;
+	m_id = s_nextID++;
+	m_running = true;
+	m_awake = true;
+	m_stopping = false;
+	s_tasks[slot] = this;
+	s_running++;
+
+	if (0 != pthread_create(&m_thread, NULL, Entry, this))
+	{
+		s_tasks[slot] = NULL;
+		s_running--;
+		m_running = false;
+		m_id = kInvalidTaskID;
+		pthread_mutex_unlock(&s_lock);
+		return false;
+	}
+
+	if (!Sim::IsRealTime())
+	{
+		WaitForIdleTasks();
+	}
+	pthread_mutex_unlock(&s_lock);
+	return true;
+}
+
+void *Task::Entry(void *arg)
+{
+	Task *task = (Task *)arg;
+	t_currentTask = task;
+	task->m_function(task->m_args[0], task->m_args[1], task->m_args[2], task->m_args[3],
+		task->m_args[4], task->m_args[5], task->m_args[6], task->m_args[7],
+		task->m_args[8], task->m_args[9]);
+	Retire(task);
+	return NULL;
+}
+
+// Called on the task's own thread as it ends.
+void Task::Retire(Task *task)
+{
+	pthread_mutex_lock(&s_lock);
+	for (INT32 i = 0; i < SIM_MAX_TASKS; i++)
+	{
+		if (task == s_tasks[i])
+		{
+			s_tasks[i] = NULL;
+		}
+	}
+	task->m_running = false;
+	if (task->m_awake)
+	{
+		task->m_awake = false;
+		s_running--;
+	}
+	pthread_cond_signal(&s_idle);
+	pthread_mutex_unlock(&s_lock);
+}
+
+bool Task::Stop()
+{
+	pthread_mutex_lock(&s_lock);
+	if (m_id == kInvalidTaskID)
+	{
+		pthread_mutex_unlock(&s_lock);
+		return false;
+	}
+
+	// The task ends the next time it waits (vxWorks would delete it
+	// wherever it was, but every task here spends its idle time in Wait).
+	m_stopping = true;
+	if (m_running && !m_awake && !Sim::IsRealTime())
+	{
+		m_awake = true;
+		s_running++;
+		pthread_cond_broadcast(&s_wakeup);
+	}
+	pthread_mutex_unlock(&s_lock);
+
+	pthread_join(m_thread, NULL);
+	m_id = kInvalidTaskID;
+	return true;
+}
+
+bool Task::IsReady()
+{
+	return Verify();
+}
+
+bool Task::Verify()
+{
+	pthread_mutex_lock(&s_lock);
+	bool running = m_running;
+	pthread_mutex_unlock(&s_lock);
+	return running;
+}
+
+INT32 Task::GetPriority()
+{
+	return m_priority;
+}
+
+bool Task::SetPriority(INT32 priority)
+{
+	m_priority = priority;
+	return true;
+}
+
+const char *Task::GetName()
+{
+	return m_name;
+}
+
+INT32 Task::GetID()
+{
+	return m_id;
+}
+
+bool Sim::InTask()
+{
+	return NULL != t_currentTask;
+}
+
+void Sim::TaskWait(double seconds)
+{
+	Task *task = t_currentTask;
+
+	if (IsRealTime())
+	{
+		if (!task->m_stopping && seconds > 0.0)
+		{
+			struct timespec ts;
+			ts.tv_sec = (time_t)seconds;
+			ts.tv_nsec = (long)((seconds - ts.tv_sec) * 1e9);
+			nanosleep(&ts, NULL);
+		}
+	}
+	else
+	{
+		pthread_mutex_lock(&s_lock);
+		task->m_wakeTime = Now() + seconds;
+		task->m_awake = false;
+		s_running--;
+		pthread_cond_signal(&s_idle);
+		while (!task->m_awake)
+		{
+			pthread_cond_wait(&s_wakeup, &s_lock);
+		}
+		pthread_mutex_unlock(&s_lock);
+	}
+
+	if (task->m_stopping)
+	{
+		Task::Retire(task);
+		pthread_exit(NULL);
+	}
+}
+
+void Sim::RunTasks()
+{
+	if (IsRealTime())
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&s_lock);
+	double now = Now();
+	bool due = false;
+	for (INT32 i = 0; i < SIM_MAX_TASKS; i++)
+	{
+		Task *task = s_tasks[i];
+		if (NULL != task && !task->m_awake && task->m_wakeTime <= now)
+		{
+			task->m_awake = true;
+			s_running++;
+			due = true;
+		}
+	}
+	if (due)
+	{
+		pthread_cond_broadcast(&s_wakeup);
+		WaitForIdleTasks();
+	}
+	pthread_mutex_unlock(&s_lock);
+}
@@ -0,0 +1,110 @@
+#include "MatchLogFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static UINT32 SwapWord(UINT32 value)
+{
+	return (value >> 24) | ((value >> 8) & 0xff00) | ((value << 8) & 0xff0000) | (value << 24);
+}
+
+MatchLogFile::MatchLogFile():
+	m_map(NULL),
+	m_mapSize(0),
+	m_records(NULL),
+	m_recordSize(0),
+	m_count(0),
+	m_dropped(0),
+	m_swap(false),
+	m_error("not open")
+{
+}
+
+MatchLogFile::~MatchLogFile()
+{
+	Close();
+}
+
+bool MatchLogFile::Open(const char *path)
+{
+	Close();
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		m_error = "cannot open file";
+		return false;
+	}
+	struct stat info;
+	if (0 != fstat(fd, &info) || (size_t)info.st_size < sizeof(MatchLogHeader))
+	{
+		close(fd);
+		m_error = "file too short for a header";
+		return false;
+	}
+	m_mapSize = info.st_size;
+	m_map = mmap(NULL, m_mapSize, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (MAP_FAILED == m_map)
+	{
+		m_map = NULL;
+		m_error = "cannot map file";
+		return false;
+	}
+
+	const MatchLogHeader *header = (const MatchLogHeader *)m_map;
+	if (0 != memcmp(header->magic, MATCH_LOG_MAGIC, sizeof(header->magic)))
+	{
+		m_error = "not a match log";
+	}
+	else if (MATCH_LOG_BYTE_ORDER != header->byteOrder &&
+			MATCH_LOG_BYTE_ORDER != SwapWord(header->byteOrder))
+	{
+		m_error = "unknown byte order";
+	}
+	else
+	{
+		m_swap = (MATCH_LOG_BYTE_ORDER != header->byteOrder);
+		m_recordSize = HeaderWord(header->recordSize);
+		m_count = HeaderWord(header->count);
+		m_dropped = HeaderWord(header->dropped);
+		if (MATCH_LOG_VERSION != HeaderWord(header->version) ||
+				sizeof(MatchLogRecord) != m_recordSize)
+		{
+			m_error = "written by a different version of the robot code";
+		}
+		else if (m_mapSize < sizeof(MatchLogHeader) + (size_t)m_count * m_recordSize)
+		{
+			m_error = "file is truncated";
+		}
+		else
+		{
+			m_records = (const UINT8 *)m_map + sizeof(MatchLogHeader);
+			m_error = NULL;
+			return true;
+		}
+	}
+	Close();
+	return false;
+}
+
+void MatchLogFile::Close()
+{
+	if (NULL != m_map)
+	{
+		munmap(m_map, m_mapSize);
+	}
+	m_map = NULL;
+	m_mapSize = 0;
+	m_records = NULL;
+	m_count = 0;
+	m_dropped = 0;
+	m_swap = false;
+}
+
+UINT32 MatchLogFile::HeaderWord(UINT32 value) const
+{
+	return m_swap ? SwapWord(value) : value;
+}
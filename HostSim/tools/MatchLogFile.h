@@ -0,0 +1,87 @@
+#ifndef MATCHLOGFILE_H_
+#define MATCHLOGFILE_H_
+
+#include "MatchLog.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// Read side of the robot's match log (MatchLog.h). The file is mapped,
+// not read, and each field is handed out as a column: a view that steps
+// through the mapped records at the record size, so nothing is copied. A
+// log written by a robot of the other byte order is swapped as each value
+// is read.
+
+template <class T>
+class MatchLogColumn
+{
+public:
+	MatchLogColumn(const UINT8 *first, UINT32 stride, UINT32 count, bool swap):
+		m_first(first), m_stride(stride), m_count(count), m_swap(swap)
+	{
+	}
+
+	UINT32 Size() const { return m_count; }
+
+	T operator[](UINT32 index) const
+	{
+		const UINT8 *field = m_first + (size_t)index * m_stride;
+		if (!m_swap)
+		{
+			return *(const T *)field;
+		}
+		UINT8 bytes[sizeof(T)];
+		for (size_t i = 0; i < sizeof(T); i++)
+		{
+			bytes[i] = field[sizeof(T) - 1 - i];
+		}
+		T value;
+		memcpy(&value, bytes, sizeof(T));
+		return value;
+	}
+
+private:
+	const UINT8 *m_first;
+	UINT32 m_stride;
+	UINT32 m_count;
+	bool m_swap;
+};
+
+class MatchLogFile
+{
+public:
+	MatchLogFile();
+	~MatchLogFile();
+
+	// Returns false (with a reason in GetError) if the file cannot be
+	// mapped or is not a match log this build understands.
+	bool Open(const char *path);
+	void Close();
+	const char *GetError() const { return m_error; }
+
+	UINT32 GetCount() const { return m_count; }
+	UINT32 GetDroppedCount() const { return m_dropped; }
+	bool IsSwapped() const { return m_swap; }
+
+	// Column of the field at the given offset in MatchLogRecord, e.g.
+	// Column<float>(offsetof(MatchLogRecord, shooter)).
+	template <class T>
+	MatchLogColumn<T> Column(size_t offset) const
+	{
+		return MatchLogColumn<T>(m_records + offset, m_recordSize, m_count, m_swap);
+	}
+
+private:
+	UINT32 HeaderWord(UINT32 value) const;
+
+	void *m_map;
+	size_t m_mapSize;
+	const UINT8 *m_records;
+	UINT32 m_recordSize;
+	UINT32 m_count;
+	UINT32 m_dropped;
+	bool m_swap;
+	const char *m_error;
+};
+
+#endif
@@ -0,0 +1,168 @@
+#include "MatchLogFile.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Reads a match log written by the robot (or the simulation) and prints a
+// summary of every column, or the whole log as CSV for a spreadsheet.
+
+typedef enum
+{
+	kColumnFloat, kColumnInt32, kColumnUInt32, kColumnInt16, kColumnUInt16, kColumnUInt8
+} ColumnType;
+
+typedef struct
+{
+	const char *name;
+	size_t offset;
+	ColumnType type;
+} ColumnInfo;
+
+#define COLUMN(field, type) { #field, offsetof(MatchLogRecord, field), type }
+
+static const ColumnInfo s_columns[] =
+{
+	COLUMN(timestamp, kColumnUInt32),
+	COLUMN(loopTime, kColumnUInt32),
+	COLUMN(stickX, kColumnFloat),
+	COLUMN(stickY, kColumnFloat),
+	COLUMN(gamepadLeftX, kColumnFloat),
+	COLUMN(gamepadLeftY, kColumnFloat),
+	COLUMN(gamepadRightX, kColumnFloat),
+	COLUMN(gamepadRightY, kColumnFloat),
+	COLUMN(potentiometer, kColumnFloat),
+	COLUMN(shooterRPM, kColumnFloat),
+	COLUMN(leftDriveCount, kColumnInt32),
+	COLUMN(rightDriveCount, kColumnInt32),
+	COLUMN(leftDrive, kColumnFloat),
+	COLUMN(rightDrive, kColumnFloat),
+	COLUMN(shooter, kColumnFloat),
+	COLUMN(indexer, kColumnFloat),
+	COLUMN(arm, kColumnFloat),
+	COLUMN(stick2Buttons, kColumnUInt16),
+	COLUMN(gamepadButtons, kColumnUInt16),
+	COLUMN(shiftCount, kColumnInt16),
+	COLUMN(gamepadDPad, kColumnUInt8),
+	COLUMN(switches, kColumnUInt8),
+	COLUMN(solenoids, kColumnUInt8),
+	COLUMN(mode, kColumnUInt8)
+};
+
+#define NUM_COLUMNS (sizeof(s_columns) / sizeof(s_columns[0]))
+
+static double Value(const MatchLogFile &log, const ColumnInfo &column, UINT32 index)
+{
+	switch (column.type)
+	{
+	case kColumnFloat:  return log.Column<float>(column.offset)[index];
+	case kColumnInt32:  return log.Column<INT32>(column.offset)[index];
+	case kColumnUInt32: return log.Column<UINT32>(column.offset)[index];
+	case kColumnInt16:  return log.Column<INT16>(column.offset)[index];
+	case kColumnUInt16: return log.Column<UINT16>(column.offset)[index];
+	case kColumnUInt8:  return log.Column<UINT8>(column.offset)[index];
+	}
+	return 0.0;
+}
+
+static void PrintSummary(const MatchLogFile &log)
+{
+	MatchLogColumn<UINT32> timestamp = log.Column<UINT32>(offsetof(MatchLogRecord, timestamp));
+	MatchLogColumn<UINT8> mode = log.Column<UINT8>(offsetof(MatchLogRecord, mode));
+
+	UINT32 autonomous = 0;
+	for (UINT32 i = 0; i < log.GetCount(); i++)
+	{
+		if (kMatchLogAutonomous == mode[i])
+		{
+			autonomous++;
+		}
+	}
+	printf("%u records (%u autonomous, %u teleop), %u dropped, %.2f s%s\n",
+		log.GetCount(), autonomous, log.GetCount() - autonomous, log.GetDroppedCount(),
+		log.GetCount() ? (timestamp[log.GetCount() - 1] - timestamp[0]) / 1e6 : 0.0,
+		log.IsSwapped() ? ", byte-swapped" : "");
+	if (0 == log.GetCount())
+	{
+		return;
+	}
+
+	printf("  %-16s %14s %14s %14s\n", "column", "min", "mean", "max");
+	for (UINT32 c = 0; c < NUM_COLUMNS; c++)
+	{
+		double min = Value(log, s_columns[c], 0);
+		double max = min;
+		double total = 0.0;
+		for (UINT32 i = 0; i < log.GetCount(); i++)
+		{
+			double value = Value(log, s_columns[c], i);
+			total += value;
+			if (value < min) min = value;
+			if (value > max) max = value;
+		}
+		printf("  %-16s %14.4g %14.4g %14.4g\n", s_columns[c].name, min,
+			total / log.GetCount(), max);
+	}
+}
+
+static void PrintCSV(const MatchLogFile &log)
+{
+	for (UINT32 c = 0; c < NUM_COLUMNS; c++)
+	{
+		printf("%s%s", c ? "," : "", s_columns[c].name);
+	}
+	printf("\n");
+	for (UINT32 i = 0; i < log.GetCount(); i++)
+	{
+		for (UINT32 c = 0; c < NUM_COLUMNS; c++)
+		{
+			printf("%s%.9g", c ? "," : "", Value(log, s_columns[c], i));
+		}
+		printf("\n");
+	}
+}
+
+int main(int argc, char **argv)
+{
+	bool csv = false;
+	const char *path = NULL;
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == strcmp(argv[i], "--csv"))
+		{
+			csv = true;
+		}
+		else if (NULL == path && '-' != argv[i][0])
+		{
+			path = argv[i];
+		}
+		else
+		{
+			path = NULL;
+			break;
+		}
+	}
+	if (NULL == path)
+	{
+		fprintf(stderr,
+			"usage: %s [--csv] FILE\n"
+			"  --csv   print every record instead of a summary of each column\n",
+			argv[0]);
+		return 1;
+	}
+
+	MatchLogFile log;
+	if (!log.Open(path))
+	{
+		fprintf(stderr, "%s: %s: %s\n", argv[0], path, log.GetError());
+		return 1;
+	}
+	if (csv)
+	{
+		PrintCSV(log);
+	}
+	else
+	{
+		PrintSummary(log);
+	}
+	return 0;
+}